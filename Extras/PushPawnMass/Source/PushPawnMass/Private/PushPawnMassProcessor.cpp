@@ -0,0 +1,177 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnMassProcessor.h"
+
+#include "MassCommonFragments.h"
+#include "MassCommonTypes.h"
+#include "MassExecutionContext.h"
+#include "MassMovementFragments.h"
+#include "PushPawnMassTypes.h"
+#include "PushPawnStats.h"
+#include "PushPawnSubsystem.h"
+#include "PushStatics.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnMassProcessor)
+
+DECLARE_CYCLE_STAT(TEXT("Mass Build Grid"), STAT_PushPawnMassBuildGrid, STATGROUP_PushPawn);
+DECLARE_CYCLE_STAT(TEXT("Mass Apply Pushes"), STAT_PushPawnMassApplyPushes, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mass Pushable Entities"), STAT_PushPawnMassEntities, STATGROUP_PushPawn);
+
+UPushPawnMassProcessor::UPushPawnMassProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Avoidance;
+}
+
+void UPushPawnMassProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FAgentRadiusFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassVelocityFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FPushPawnMassFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassForceFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FPushPawnMassParams>();
+}
+
+float UPushPawnMassProcessor::BuildGrid(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PushPawnMassBuildGrid);
+
+	Agents.Reset();
+	float MaxRadius = 0.f;
+	float MaxScanRangeScalar = 0.f;
+
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [this, &MaxRadius, &MaxScanRangeScalar](FMassExecutionContext& Context)
+	{
+		const FPushPawnMassParams& Params = Context.GetConstSharedFragment<FPushPawnMassParams>();
+		const TConstArrayView<FTransformFragment> Transforms = Context.GetFragmentView<FTransformFragment>();
+		const TConstArrayView<FAgentRadiusFragment> Radii = Context.GetFragmentView<FAgentRadiusFragment>();
+		const TConstArrayView<FPushPawnMassFragment> Pushes = Context.GetFragmentView<FPushPawnMassFragment>();
+
+		MaxScanRangeScalar = FMath::Max(MaxScanRangeScalar, Params.ScanRangeScalar);
+		for (int32 i = 0; i < Context.GetNumEntities(); i++)
+		{
+			const float Radius = Pushes[i].PushRadius > 0.f ? Pushes[i].PushRadius : Radii[i].Radius;
+			MaxRadius = FMath::Max(MaxRadius, Radius);
+			Agents.Add({ Transforms[i].GetTransform().GetLocation(), Radius, Pushes[i].PushGroup, FIntPoint::ZeroValue, Context.GetEntity(i) });
+		}
+	});
+
+	INC_DWORD_STAT_BY(STAT_PushPawnMassEntities, Agents.Num());
+
+	// A cell must be at least as large as the largest push range, so only neighbouring cells need to be queried
+	const float CellSize = FMath::Max(2.f * MaxRadius * MaxScanRangeScalar, 1.f);
+	NumBuckets = FMath::RoundUpToPowerOfTwo(FMath::Max(Agents.Num(), 1));
+
+	// Counting sort the agents by bucket
+	BucketStart.Reset();
+	BucketStart.SetNumZeroed(NumBuckets + 1);
+	for (FPushPawnMassAgent& Agent : Agents)
+	{
+		Agent.Cell = FIntPoint(FMath::FloorToInt32(Agent.Location.X / CellSize), FMath::FloorToInt32(Agent.Location.Y / CellSize));
+		BucketStart[GetBucket(Agent.Cell) + 1]++;
+	}
+	for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+	{
+		BucketStart[Bucket + 1] += BucketStart[Bucket];
+	}
+
+	BucketCursor.Reset();
+	BucketCursor.Append(BucketStart.GetData(), NumBuckets);
+	SortedAgents.SetNumUninitialized(Agents.Num());
+	for (int32 i = 0; i < Agents.Num(); i++)
+	{
+		SortedAgents[BucketCursor[GetBucket(Agents[i].Cell)]++] = i;
+	}
+
+	return CellSize;
+}
+
+void UPushPawnMassProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawnMassProcessor::Execute);
+
+	const float CellSize = BuildGrid(EntityManager, Context);
+	if (Agents.Num() < 2)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_PushPawnMassApplyPushes);
+
+	// Only read from here on, safe to share between chunks
+	const UPushPawnSubsystem* Subsystem = UPushPawnSubsystem::Get(EntityManager.GetWorld());
+
+	EntityQuery.ParallelForEachEntityChunk(EntityManager, Context, [this, CellSize, Subsystem](FMassExecutionContext& Context)
+	{
+		const FPushPawnMassParams& Params = Context.GetConstSharedFragment<FPushPawnMassParams>();
+		const TConstArrayView<FTransformFragment> Transforms = Context.GetFragmentView<FTransformFragment>();
+		const TConstArrayView<FAgentRadiusFragment> Radii = Context.GetFragmentView<FAgentRadiusFragment>();
+		const TConstArrayView<FMassVelocityFragment> Velocities = Context.GetFragmentView<FMassVelocityFragment>();
+		const TConstArrayView<FPushPawnMassFragment> Pushes = Context.GetFragmentView<FPushPawnMassFragment>();
+		const TArrayView<FMassForceFragment> Forces = Context.GetMutableFragmentView<FMassForceFragment>();
+
+		// Spread the push over the same duration a root motion source would last for a pawn
+		const float ForceScale = 1.f / FMath::Max(Params.ActionParams.Duration, KINDA_SMALL_NUMBER);
+
+		for (int32 i = 0; i < Context.GetNumEntities(); i++)
+		{
+			const FMassEntityHandle Entity = Context.GetEntity(i);
+			const FVector Location = Transforms[i].GetTransform().GetLocation();
+			const float Radius = Pushes[i].PushRadius > 0.f ? Pushes[i].PushRadius : Radii[i].Radius;
+			const float Speed = Params.bDirectionIs2D ? Velocities[i].Value.Size2D() : Velocities[i].Value.Size();
+			const FIntPoint Cell(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+
+			FVector PushVelocity = FVector::ZeroVector;
+			for (int32 Y = -1; Y <= 1; Y++)
+			{
+				for (int32 X = -1; X <= 1; X++)
+				{
+					const FIntPoint NeighbourCell = Cell + FIntPoint(X, Y);
+					const int32 Bucket = GetBucket(NeighbourCell);
+					for (int32 Sorted = BucketStart[Bucket]; Sorted < BucketStart[Bucket + 1]; Sorted++)
+					{
+						const FPushPawnMassAgent& Other = Agents[SortedAgents[Sorted]];
+
+						// Buckets are shared by hash collisions, skip agents from other cells so none are counted twice
+						if (Other.Cell != NeighbourCell || Other.Entity == Entity)
+						{
+							continue;
+						}
+
+						if (Subsystem && !Subsystem->CanPushGroupPush(Other.PushGroup, Pushes[i].PushGroup))
+						{
+							continue;
+						}
+
+						FVector Delta = Location - Other.Location;
+						if (Params.bDirectionIs2D)
+						{
+							Delta.Z = 0.f;
+						}
+
+						const float CombinedRadius = Radius + Other.Radius;
+						const float ScanRange = CombinedRadius * Params.ScanRangeScalar;
+						const float DistanceSq = Delta.SizeSquared();
+						if (DistanceSq >= FMath::Square(ScanRange))
+						{
+							continue;
+						}
+
+						// Entities on top of each other separate along X, in opposite directions
+						const float Distance = FMath::Sqrt(DistanceSq);
+						const FVector Direction = Distance > KINDA_SMALL_NUMBER ? Delta / Distance :
+							(Entity.Index < Other.Entity.Index ? FVector::ForwardVector : FVector::BackwardVector);
+
+						const float NormalizedDistance = Distance / CombinedRadius;
+						PushVelocity += Direction * UPushStatics::GetPushStrengthForSpeed(Speed, NormalizedDistance, Params.ActionParams);
+					}
+				}
+			}
+
+			Forces[i].Value += PushVelocity * ForceScale;
+		}
+	});
+}
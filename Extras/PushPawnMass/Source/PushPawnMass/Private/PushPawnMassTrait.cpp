@@ -0,0 +1,26 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnMassTrait.h"
+
+#include "MassCommonFragments.h"
+#include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
+#include "MassMovementFragments.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnMassTrait)
+
+void UPushPawnMassTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	FMassEntityManager& EntityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+
+	BuildContext.RequireFragment<FTransformFragment>();
+	BuildContext.RequireFragment<FAgentRadiusFragment>();
+	BuildContext.RequireFragment<FMassVelocityFragment>();
+	BuildContext.RequireFragment<FMassForceFragment>();
+
+	BuildContext.AddFragment_GetRef<FPushPawnMassFragment>() = Push;
+
+	const FConstSharedStruct ParamsFragment = EntityManager.GetOrCreateConstSharedFragment(Params);
+	BuildContext.AddConstSharedFragment(ParamsFragment);
+}
@@ -0,0 +1,67 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityQuery.h"
+#include "MassProcessor.h"
+#include "PushPawnMassProcessor.generated.h"
+
+/** Flattened entity state used to build the neighbour grid */
+struct FPushPawnMassAgent
+{
+	FVector Location;
+	float Radius;
+	int32 PushGroup;
+	FIntPoint Cell;
+	FMassEntityHandle Entity;
+};
+
+/**
+ * Pushes Mass entities away from each other, the Mass equivalent of the push scan and action abilities
+ *
+ * Every entity is gathered into a spatial hash grid sized by the largest push range, then each entity queries the
+ * neighbouring cells and accumulates a push velocity in parallel chunks. Push strength is evaluated with
+ * UPushStatics::GetPushStrengthForSpeed() using the same curves as pawns, and applied via FMassForceFragment.
+ * @see UPushPawnMassTrait
+ */
+UCLASS()
+class PUSHPAWNMASS_API UPushPawnMassProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UPushPawnMassProcessor();
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	/** Rebuild the spatial hash from every pushable entity, returns the grid cell size */
+	float BuildGrid(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
+
+	int32 GetBucket(const FIntPoint& Cell) const
+	{
+		// Hashed in uint32, signed overflow is undefined
+		const uint32 Hash = (static_cast<uint32>(Cell.X) * 73856093u) ^ (static_cast<uint32>(Cell.Y) * 19349663u);
+		return static_cast<int32>(Hash & static_cast<uint32>(NumBuckets - 1));
+	}
+
+protected:
+	FMassEntityQuery EntityQuery;
+
+	// Grid storage is kept between frames to avoid re-allocating
+
+	TArray<FPushPawnMassAgent> Agents;
+
+	/** Agent indices sorted by bucket */
+	TArray<int32> SortedAgents;
+
+	/** Index into SortedAgents where each bucket starts, with one extra entry for the end */
+	TArray<int32> BucketStart;
+
+	/** Next free slot in SortedAgents for each bucket while sorting */
+	TArray<int32> BucketCursor;
+
+	int32 NumBuckets = 1;
+};
@@ -0,0 +1,28 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTraitBase.h"
+#include "PushPawnMassTypes.h"
+#include "PushPawnMassTrait.generated.h"
+
+/**
+ * Makes Mass entities push each other with the same soft push feel as PushPawn pawns
+ * Requires the movement trait, pushes are applied via FMassForceFragment
+ */
+UCLASS(meta=(DisplayName="PushPawn"))
+class PUSHPAWNMASS_API UPushPawnMassTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, Category=PushPawn)
+	FPushPawnMassFragment Push;
+
+	UPROPERTY(EditAnywhere, Category=PushPawn)
+	FPushPawnMassParams Params;
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+};
@@ -0,0 +1,55 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "PushTypes.h"
+#include "PushPawnMassTypes.generated.h"
+
+/**
+ * Per-entity push shape, the Mass equivalent of the pushee's collision and push group
+ */
+USTRUCT()
+struct PUSHPAWNMASS_API FPushPawnMassFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	/** Radius used for pushing, if zero the entity's FAgentRadiusFragment is used */
+	UPROPERTY(EditAnywhere, Category=PushPawn, meta=(ClampMin="0", UIMin="0", ForceUnits="cm"))
+	float PushRadius = 0.f;
+
+	/** Push group checked against UPushPawnSubsystem's push group matrix, INDEX_NONE to push and be pushed by everyone */
+	UPROPERTY(EditAnywhere, Category=PushPawn)
+	int32 PushGroup = INDEX_NONE;
+};
+
+/**
+ * Push parameters shared by every entity of a template
+ * Mirrors FPushPawnScanParams and FPushPawnActionParams so entities feel the same as pawns
+ */
+USTRUCT()
+struct PUSHPAWNMASS_API FPushPawnMassParams : public FMassConstSharedFragment
+{
+	GENERATED_BODY()
+
+	FPushPawnMassParams()
+		: bDirectionIs2D(true)
+		, ScanRangeScalar(1.f)
+	{}
+
+	/** If true, calculate the direction using X/Y only */
+	UPROPERTY(EditAnywhere, Category=PushPawn)
+	bool bDirectionIs2D;
+
+	/** Modifies the range at which entities push each other, as a multiple of their combined radius */
+	UPROPERTY(EditAnywhere, Category=PushPawn, meta=(ClampMin="0", UIMin="0", Delta="0.1", ForceUnits="x"))
+	float ScanRangeScalar;
+
+	/**
+	 * The push strength curves and scalar
+	 * The push velocity is applied as a steering force over Duration, the same window the root motion source lasts for pawns
+	 */
+	UPROPERTY(EditAnywhere, Category=PushPawn)
+	FPushPawnActionParams ActionParams;
+};
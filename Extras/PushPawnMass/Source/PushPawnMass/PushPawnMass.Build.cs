@@ -0,0 +1,32 @@
+// Copyright (c) Jared Taylor. All Rights Reserved
+
+using UnrealBuildTool;
+
+public class PushPawnMass : ModuleRules
+{
+	public PushPawnMass(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"MassEntity",
+				"MassCommon",
+				"MassMovement",
+				"MassSpawner",
+				"PushPawn",
+			}
+			);
+			
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+			}
+			);
+	}
+}
@@ -0,0 +1,51 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnLayeredMove.h"
+
+#include "MoverSimulationTypes.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnLayeredMove)
+
+FLayeredMove_PushPawnForce::FLayeredMove_PushPawnForce()
+{
+	// Layer on top of the pawn's own movement, the same as an additive root motion source
+	MixMode = EMoveMixMode::AdditiveVelocity;
+}
+
+bool FLayeredMove_PushPawnForce::GenerateMove(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep,
+	const UMoverComponent* MoverComp, UMoverBlackboard* SimBlackboard, FProposedMove& OutProposedMove)
+{
+	OutProposedMove.MixMode = MixMode;
+	OutProposedMove.LinearVelocity = Force;
+
+	return true;
+}
+
+FLayeredMoveBase* FLayeredMove_PushPawnForce::Clone() const
+{
+	FLayeredMove_PushPawnForce* CopyPtr = new FLayeredMove_PushPawnForce(*this);
+	return CopyPtr;
+}
+
+void FLayeredMove_PushPawnForce::NetSerialize(FArchive& Ar)
+{
+	Super::NetSerialize(Ar);
+
+	SerializePackedVector<10, 16>(Force, Ar);
+}
+
+UScriptStruct* FLayeredMove_PushPawnForce::GetScriptStruct() const
+{
+	return FLayeredMove_PushPawnForce::StaticStruct();
+}
+
+FString FLayeredMove_PushPawnForce::ToSimpleString()
+{
+	return FString::Printf(TEXT("PushPawnForce Force=%s"), *Force.ToCompactString());
+}
+
+void FLayeredMove_PushPawnForce::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(Collector);
+}
@@ -0,0 +1,28 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#include "PushPawnMover.h"
+
+#include "PushPawnMoverForceBackend.h"
+#include "Features/IModularFeatures.h"
+
+#define LOCTEXT_NAMESPACE "FPushPawnMoverModule"
+
+void FPushPawnMoverModule::StartupModule()
+{
+	// Push actions pick this up automatically for pawns with a UMoverComponent
+	ForceBackend = MakeUnique<FPushPawnMoverForceBackend>();
+	IModularFeatures::Get().RegisterModularFeature(IPushPawnForceBackend::GetModularFeatureName(), ForceBackend.Get());
+}
+
+void FPushPawnMoverModule::ShutdownModule()
+{
+	if (ForceBackend.IsValid())
+	{
+		IModularFeatures::Get().UnregisterModularFeature(IPushPawnForceBackend::GetModularFeatureName(), ForceBackend.Get());
+		ForceBackend.Reset();
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FPushPawnMoverModule, PushPawnMover)
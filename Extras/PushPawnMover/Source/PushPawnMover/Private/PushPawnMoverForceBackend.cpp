@@ -0,0 +1,39 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnMoverForceBackend.h"
+
+#include "PushPawnLayeredMove.h"
+#include "PushTypes.h"
+#include "MoverComponent.h"
+#include "GameFramework/Pawn.h"
+#include "PushPawnStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mover Pushes Queued"), STAT_PushPawnMoverPushes, STATGROUP_PushPawn);
+
+bool FPushPawnMoverForceBackend::CanApplyPushForce(const APawn* Pushee) const
+{
+	return Pushee && Pushee->FindComponentByClass<UMoverComponent>() != nullptr;
+}
+
+void FPushPawnMoverForceBackend::ApplyPushForce(const APawn* Pushee, const FVector& PushForce, float Duration,
+	const FPushPawnActionParams& Params)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPushPawnMoverForceBackend::ApplyPushForce);
+
+	UMoverComponent* MoverComponent = Pushee ? Pushee->FindComponentByClass<UMoverComponent>() : nullptr;
+	if (!MoverComponent || PushForce.IsNearlyZero())
+	{
+		return;
+	}
+
+	// Queued layered moves become part of Mover's sync state, so they are rolled back and re-simulated by Mover
+	// itself instead of GAS root motion
+	TSharedPtr<FLayeredMove_PushPawnForce> PushMove = MakeShared<FLayeredMove_PushPawnForce>();
+	PushMove->Force = Params.bDistanceCheck2D ? FVector(PushForce.X, PushForce.Y, 0.f) : PushForce;
+	PushMove->DurationMs = Duration * 1000.f;
+	MoverComponent->QueueLayeredMove(PushMove);
+
+	// Counted here, GenerateMove runs for every step the move is active including re-simulated steps
+	INC_DWORD_STAT(STAT_PushPawnMoverPushes);
+}
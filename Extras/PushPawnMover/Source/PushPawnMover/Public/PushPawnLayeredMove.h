@@ -0,0 +1,46 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LayeredMove.h"
+#include "PushPawnLayeredMove.generated.h"
+
+/**
+ * Lightweight layered move that adds a constant push velocity for its duration
+ * The Mover equivalent of the PushPawnForce root motion source
+ */
+USTRUCT(BlueprintType)
+struct PUSHPAWNMOVER_API FLayeredMove_PushPawnForce : public FLayeredMoveBase
+{
+	GENERATED_BODY()
+
+	FLayeredMove_PushPawnForce();
+	virtual ~FLayeredMove_PushPawnForce() override {}
+
+	/** Push velocity added each step, direction * strength */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=PushPawn)
+	FVector Force = FVector::ZeroVector;
+
+	virtual bool GenerateMove(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep,
+		const UMoverComponent* MoverComp, UMoverBlackboard* SimBlackboard, FProposedMove& OutProposedMove) override;
+
+	virtual FLayeredMoveBase* Clone() const override;
+
+	virtual void NetSerialize(FArchive& Ar) override;
+
+	virtual UScriptStruct* GetScriptStruct() const override;
+
+	virtual FString ToSimpleString() override;
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FLayeredMove_PushPawnForce> : public TStructOpsTypeTraitsBase2<FLayeredMove_PushPawnForce>
+{
+	enum
+	{
+		WithCopy = true
+	};
+};
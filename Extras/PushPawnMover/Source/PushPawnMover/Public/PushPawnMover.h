@@ -0,0 +1,20 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+class FPushPawnMoverForceBackend;
+
+class FPushPawnMoverModule : public IModuleInterface
+{
+public:
+
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	TUniquePtr<FPushPawnMoverForceBackend> ForceBackend;
+};
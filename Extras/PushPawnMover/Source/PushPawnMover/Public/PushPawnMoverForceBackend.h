@@ -0,0 +1,18 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PushPawnForceBackend.h"
+
+/**
+ * Pushes pawns with a UMoverComponent by queueing a FLayeredMove_PushPawnForce
+ * Registered by the PushPawnMover module
+ */
+class PUSHPAWNMOVER_API FPushPawnMoverForceBackend : public IPushPawnForceBackend
+{
+public:
+	virtual bool CanApplyPushForce(const APawn* Pushee) const override;
+	virtual void ApplyPushForce(const APawn* Pushee, const FVector& PushForce, float Duration,
+		const FPushPawnActionParams& Params) override;
+};
@@ -0,0 +1,29 @@
+// Copyright (c) Jared Taylor. All Rights Reserved
+
+using UnrealBuildTool;
+
+public class PushPawnMover : ModuleRules
+{
+	public PushPawnMover(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"Mover",
+				"PushPawn",
+			}
+			);
+			
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+			}
+			);
+	}
+}
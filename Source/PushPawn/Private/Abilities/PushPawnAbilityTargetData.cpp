@@ -0,0 +1,211 @@
+// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "Abilities/PushPawnAbilityTargetData.h"
+
+#include "PushPawnStats.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnAbilityTargetData)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Push Target Data Pool Hits"), STAT_PushPawnTargetDataPoolHits, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Push Target Data Pool Misses"), STAT_PushPawnTargetDataPoolMisses, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Push Target Data Bits Sent"), STAT_PushPawnTargetDataBitsSent, STATGROUP_PushPawn);
+
+namespace PushPawnTargetData
+{
+	static bool IsDirection2D(const FVector& Direction)
+	{
+		return FMath::IsNearlyZero(Direction.Z, UE_KINDA_SMALL_NUMBER);
+	}
+
+	static uint16 CompressYaw(const FVector& Direction)
+	{
+		return FRotator::CompressAxisToShort(FMath::RadiansToDegrees(FMath::Atan2(Direction.Y, Direction.X)));
+	}
+
+	static FVector DecompressYaw(uint16 Yaw)
+	{
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(FRotator::DecompressAxisFromShort(Yaw)));
+		return FVector(Cos, Sin, 0.f);
+	}
+
+	static uint16 CompressNormalizedDistance(float NormalizedDistance)
+	{
+		constexpr float MaxNormalizedDistance = FPushPawnPushTargetData::MaxNormalizedDistance;
+		return FMath::RoundToInt(FMath::Clamp(NormalizedDistance / MaxNormalizedDistance, 0.f, 1.f) * MAX_uint16);
+	}
+
+	static float DecompressNormalizedDistance(uint16 QuantizedDistance)
+	{
+		return (QuantizedDistance / static_cast<float>(MAX_uint16)) * FPushPawnPushTargetData::MaxNormalizedDistance;
+	}
+
+	/** Matches FVector_NetQuantizeNormal, each component is sent as a 16-bit fixed compressed float in [-1, 1] */
+	static float QuantizeNormalComponent(float Value)
+	{
+		constexpr float MaxBitValue = (1 << 15) - 1;
+		return FMath::RoundToFloat(FMath::Clamp(Value, -1.f, 1.f) * MaxBitValue) / MaxBitValue;
+	}
+
+	static bool IsFixedPointStrength(float StrengthScalar)
+	{
+		const float FixedPoint = StrengthScalar * 256.f;
+		return StrengthScalar >= 0.f && StrengthScalar < FPushPawnPushTargetData::MaxFixedPointStrength &&
+			FMath::IsNearlyEqual(FixedPoint, FMath::RoundToFloat(FixedPoint), 0.01f);
+	}
+}
+
+void FPushPawnPushTargetData::Quantize()
+{
+	using namespace PushPawnTargetData;
+
+	if (IsDirection2D(Direction))
+	{
+		Direction = DecompressYaw(CompressYaw(Direction));
+	}
+	else
+	{
+		Direction = FVector(QuantizeNormalComponent(Direction.X), QuantizeNormalComponent(Direction.Y),
+			QuantizeNormalComponent(Direction.Z));
+	}
+
+	NormalizedDistance = DecompressNormalizedDistance(CompressNormalizedDistance(NormalizedDistance));
+
+	if (!HasCustomStrength())
+	{
+		StrengthScalar = 1.f;
+	}
+	else if (IsFixedPointStrength(StrengthScalar))
+	{
+		StrengthScalar = FMath::RoundToInt(StrengthScalar * 256.f) / 256.f;
+	}
+}
+
+bool FPushPawnPushTargetData::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace PushPawnTargetData;
+
+	bOutSuccess = true;
+	int32 NumBits = 0;
+
+	// Direction, 2D directions are just a yaw
+	uint8 bIs2D = Ar.IsSaving() ? IsDirection2D(Direction) : 0;
+	Ar.SerializeBits(&bIs2D, 1);
+	NumBits += 1;
+	if (bIs2D)
+	{
+		uint16 Yaw = Ar.IsSaving() ? CompressYaw(Direction) : 0;
+		Ar << Yaw;
+		NumBits += 16;
+		if (Ar.IsLoading())
+		{
+			Direction = DecompressYaw(Yaw);
+		}
+	}
+	else
+	{
+		Direction.NetSerialize(Ar, Map, bOutSuccess);
+		NumBits += 48;
+	}
+
+	// Distance as a fraction of the combined radius
+	uint16 QuantizedDistance = Ar.IsSaving() ? CompressNormalizedDistance(NormalizedDistance) : 0;
+	Ar << QuantizedDistance;
+	NumBits += 16;
+	if (Ar.IsLoading())
+	{
+		NormalizedDistance = DecompressNormalizedDistance(QuantizedDistance);
+	}
+
+	// Strength, omitted entirely when default
+	uint8 bHasCustomStrength = Ar.IsSaving() ? HasCustomStrength() : 0;
+	Ar.SerializeBits(&bHasCustomStrength, 1);
+	NumBits += 1;
+	if (bHasCustomStrength)
+	{
+		uint8 bOverride = bOverrideStrength;
+		Ar.SerializeBits(&bOverride, 1);
+		bOverrideStrength = bOverride != 0;
+
+		// Fixed-point if it fits without losing precision, otherwise a full float
+		const float FixedPoint = StrengthScalar * 256.f;
+		uint8 bIsFixedPoint = Ar.IsSaving() ? IsFixedPointStrength(StrengthScalar) : 0;
+		Ar.SerializeBits(&bIsFixedPoint, 1);
+		NumBits += 2;
+		if (bIsFixedPoint)
+		{
+			uint16 FixedStrength = Ar.IsSaving() ? static_cast<uint16>(FMath::RoundToInt(FixedPoint)) : 0;
+			Ar << FixedStrength;
+			NumBits += 16;
+			if (Ar.IsLoading())
+			{
+				StrengthScalar = FixedStrength / 256.f;
+			}
+		}
+		else
+		{
+			Ar << StrengthScalar;
+			NumBits += 32;
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		StrengthScalar = 1.f;
+		bOverrideStrength = false;
+	}
+
+	if (Ar.IsSaving())
+	{
+		INC_DWORD_STAT_BY(STAT_PushPawnTargetDataBitsSent, NumBits);
+	}
+	return true;
+}
+
+FPushPawnTargetDataPool& FPushPawnTargetDataPool::Get()
+{
+	check(IsInGameThread());
+
+	static FPushPawnTargetDataPool Pool;
+	return Pool;
+}
+
+TSharedPtr<FGameplayAbilityTargetData> FPushPawnTargetDataPool::Acquire(const FVector& Direction,
+	float NormalizedDistance, float StrengthScalar, bool bOverrideStrength)
+{
+	check(IsInGameThread());
+
+	// Re-use an entry that no handle references anymore, this only adds a reference to the existing allocation
+	for (int32 i = 0; i < Entries.Num(); i++)
+	{
+		const int32 EntryIndex = (NextEntry + i) % Entries.Num();
+		const TSharedPtr<FPushPawnPushTargetData>& Entry = Entries[EntryIndex];
+		if (Entry.IsUnique())
+		{
+			INC_DWORD_STAT(STAT_PushPawnTargetDataPoolHits);
+			NextEntry = (EntryIndex + 1) % Entries.Num();
+			*Entry = FPushPawnPushTargetData(Direction, NormalizedDistance, StrengthScalar, bOverrideStrength);
+			return Entry;
+		}
+	}
+
+	// Allocate the target data and its reference controller together, and keep it for re-use if there is room
+	INC_DWORD_STAT(STAT_PushPawnTargetDataPoolMisses);
+	const TSharedPtr<FPushPawnPushTargetData> TargetData = MakeShared<FPushPawnPushTargetData>(Direction,
+		NormalizedDistance, StrengthScalar, bOverrideStrength);
+	if (Entries.Num() < MaxPoolSize)
+	{
+		Entries.Add(TargetData);
+	}
+	return TargetData;
+}
+
+int32 FPushPawnTargetDataPool::GetNumFree() const
+{
+	int32 NumFree = 0;
+	for (const TSharedPtr<FPushPawnPushTargetData>& Entry : Entries)
+	{
+		NumFree += Entry.IsUnique() ? 1 : 0;
+	}
+	return NumFree;
+}
@@ -52,6 +52,13 @@ bool UPushPawn_Action::ActivatePushPawnAbility(const FGameplayAbilitySpecHandle
 		CancelAbility(Handle, ActorInfo, ActivationInfo, false);
 		return false;
 	}
+
+	// Reject invalid pushes predicted by the client
+	if (!ValidateClientPush(ActorInfo, Pushee, Pusher, EventData, PushParams.bDistanceCheck2D))
+	{
+		CancelAbility(Handle, ActorInfo, ActivationInfo, true);
+		return false;
+	}
 	
 	// Gather Push Data
 	UPushStatics::GetPushDataFromEventData(EventData, PushParams.bDistanceCheck2D, PushDirection,
@@ -61,6 +68,15 @@ bool UPushPawn_Action::ActivatePushPawnAbility(const FGameplayAbilitySpecHandle
 	NormalizedDistance = UPushStatics::GetNormalizedPushDistance(Pushee, Pusher, DistanceBetween);
 	Strength = UPushStatics::CalculatePushStrength(Pushee, bOverrideStrength, StrengthScalar, NormalizedDistance, PushParams);
 
+	// Combine the forces from any batched pushes into a single push
+	if (UPushStatics::GetNumPushesInEventData(EventData) > 1)
+	{
+		const FVector PushForce = UPushStatics::AccumulateBatchedPushForce(Pushee, EventData, 1, PushParams,
+			PushDirection * Strength);
+		PushDirection = PushParams.bDistanceCheck2D ? PushForce.GetSafeNormal2D() : PushForce.GetSafeNormal();
+		Strength = PushForce.Size();
+	}
+
 #if UE_ENABLE_DEBUG_DRAWING
 	if (FPushPawnCVars::PushPawnActionDebugDraw > 0)  // Use WantsPushPawnActionDebugDraw() in derived classes
 	{
@@ -74,11 +90,19 @@ bool UPushPawn_Action::ActivatePushPawnAbility(const FGameplayAbilitySpecHandle
 	}
 #endif
 
+	// Accumulate the push on the movement component instead of using a root motion source
+	if (UPushStatics::AccumulatePushForce(Pushee, PushDirection * Strength, PushParams.ForceBackend))
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
+		return true;
+	}
+
 	// Apply Push Force Task
 	static constexpr bool bIsAdditive = true;
 	static constexpr bool bEnableGravity = true;
-	UAbilityTask_PushPawnForce* PushTask = UAbilityTask_PushPawnForce::ApplyPushPawnForce(
-		this, PushDirection, Strength, PushParams.Duration, bIsAdditive, bEnableGravity);
+	PushTask = UAbilityTask_PushPawnForce::ApplyPushPawnForce(
+		this, PushDirection, Strength, PushParams.Duration, bIsAdditive, bEnableGravity, nullptr,
+		PushParams.bMergePushForces);
 
 	// Bind EndAbility to OnFinish
 	PushTask->OnFinish.AddDynamic(this, &UPushPawn_Action::OnPushTaskFinished);
@@ -91,5 +115,8 @@ bool UPushPawn_Action::ActivatePushPawnAbility(const FGameplayAbilitySpecHandle
 
 void UPushPawn_Action::OnPushTaskFinished()
 {
+	// The task may be pooled and re-used elsewhere once it has finished
+	PushTask = nullptr;
+
 	K2_EndAbility();
 }
@@ -3,11 +3,23 @@
 
 #include "Abilities/PushPawn_Action_Base.h"
 
+#include "Abilities/PushPawnAbilityTargetData.h"
 #include "IPush.h"
 #include "PushStatics.h"
+#include "PushPawnStats.h"
+#include "PushPawnSubsystem.h"
+#include "PushPawnTags.h"
+#include "PushPawnValidationSubsystem.h"
+
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawn_Action_Base)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Client Pushes Validated"), STAT_PushPawnClientPushesValidated, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Client Pushes Fully Validated"), STAT_PushPawnClientPushesFullyValidated, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Client Pushes Rejected"), STAT_PushPawnClientPushesRejected, STATGROUP_PushPawn);
+
 bool UPushPawn_Action_Base::CanActivatePushPawnAbility(const AActor* AvatarActor) const
 {
 	if (!IsValid(AvatarActor))
@@ -30,6 +42,117 @@ bool UPushPawn_Action_Base::CanActivatePushPawnAbility(const AActor* AvatarActor
 	return false;
 }
 
+bool UPushPawn_Action_Base::ValidateClientPush(const FGameplayAbilityActorInfo* ActorInfo, const APawn* Pushee,
+	const APawn* Pusher, const FGameplayEventData& EventData, bool bDistanceCheck2D) const
+{
+	// Only pushes predicted by a client need validating
+	if (!ValidationParams.bValidateClientPushes || !ActorInfo || !ActorInfo->IsNetAuthority() || ActorInfo->IsLocallyControlled())
+	{
+		return true;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawn_Action_Base::ValidateClientPush);
+	INC_DWORD_STAT(STAT_PushPawnClientPushesValidated);
+
+	const APlayerController* Client = ActorInfo->PlayerController.Get();
+	auto Reject = [Client, this]()
+	{
+		INC_DWORD_STAT(STAT_PushPawnClientPushesRejected);
+		UPushPawnValidationSubsystem::ReportInvalidPush(Client, ValidationParams);
+		return false;
+	};
+
+	if (!Pushee || !Pusher || !EventData.TargetData.Get(0))
+	{
+		return Reject();
+	}
+
+	// The first push carries the pusher, batched pushes only carry their own data
+	FVector PushDirection;
+	float DistanceBetween, StrengthScalar;
+	bool bOverrideStrength;
+	UPushStatics::GetPushDataFromEventData(EventData, bDistanceCheck2D, PushDirection, DistanceBetween,
+		StrengthScalar, bOverrideStrength);
+	const float NormalizedDistance = UPushStatics::GetNormalizedPushDistance(Pushee, Pusher, DistanceBetween);
+
+	// Cheap bounds checks for every push
+	if (StrengthScalar > ValidationParams.MaxStrengthScalar || NormalizedDistance > ValidationParams.MaxNormalizedDistance)
+	{
+		return Reject();
+	}
+
+	// Cap the batch size and check every batched push in a single pass, the client controls how many there are
+	int32 NumPushes = 0;
+	for (const TSharedPtr<FGameplayAbilityTargetData>& TargetData : EventData.TargetData.Data)
+	{
+		if (!TargetData.IsValid() || TargetData->GetScriptStruct() != FPushPawnPushTargetData::StaticStruct())
+		{
+			continue;
+		}
+		if (++NumPushes > ValidationParams.MaxBatchedPushes)
+		{
+			return Reject();
+		}
+
+		const FPushPawnPushTargetData& PushTargetData = static_cast<const FPushPawnPushTargetData&>(*TargetData);
+		if (PushTargetData.StrengthScalar > ValidationParams.MaxStrengthScalar ||
+			PushTargetData.NormalizedDistance > ValidationParams.MaxNormalizedDistance)
+		{
+			return Reject();
+		}
+	}
+
+	// Pushes predicted while a net sync was outstanding are always fully validated, the rest are sampled
+	const bool bNetSyncPending = EventData.InstigatorTags.HasTagExact(FPushPawnTags::PushPawn_NetSync_Pending);
+	if (!bNetSyncPending && !UPushPawnValidationSubsystem::ShouldFullyValidatePush(Client, ValidationParams))
+	{
+		return true;
+	}
+
+	INC_DWORD_STAT(STAT_PushPawnClientPushesFullyValidated);
+
+	// The pusher must be allowed to push us at all
+	const IPusheeInstigator* PusheeInstigator = UPushStatics::GetPusheeInstigator(Pushee);
+	const IPusherTarget* PusherTarget = UPushStatics::GetPusherTarget(Pusher);
+	if (!PusheeInstigator || !PusherTarget ||
+		!UPushPawnSubsystem::IsPushAllowedByGroup(Pushee->GetWorld(), PusherTarget->GetPusherPushGroup(), PusheeInstigator->GetPusheePushGroup()) ||
+		!PusheeInstigator->CanBePushedBy(Pusher) || !PusherTarget->CanPushPawn(Pushee))
+	{
+		return Reject();
+	}
+
+	// Compare to the server's own positions, these lag the client so the tolerances are generous
+	const FVector ServerOffset = Pushee->GetActorLocation() - Pusher->GetActorLocation();
+	const float ServerDistance = bDistanceCheck2D ? ServerOffset.Size2D() : ServerOffset.Size();
+	const float ServerNormalizedDistance = UPushStatics::GetNormalizedPushDistance(Pushee, Pusher, ServerDistance);
+	if (FMath::Abs(ServerNormalizedDistance - NormalizedDistance) > ValidationParams.MaxNormalizedDistanceError)
+	{
+		return Reject();
+	}
+
+	// Pawns that overlap almost exactly have no meaningful direction, @see UPushStatics::GetTieBreakPushDirection()
+	if (!ServerOffset.IsNearlyZero(2.5f))
+	{
+		const FVector ServerDirection = bDistanceCheck2D ? ServerOffset.GetSafeNormal2D() : ServerOffset.GetSafeNormal();
+		if ((ServerDirection | PushDirection) < FMath::Cos(FMath::DegreesToRadians(ValidationParams.MaxDirectionError)))
+		{
+			return Reject();
+		}
+	}
+
+	// Without an override the strength scalar is simply the product of both pawns' scalars
+	if (!bOverrideStrength)
+	{
+		const float ServerStrengthScalar = PusheeInstigator->GetPusheeStrengthScalar() * PusherTarget->GetPusherStrengthScalar();
+		if (!FMath::IsNearlyEqual(ServerStrengthScalar, StrengthScalar, 0.01f))
+		{
+			return Reject();
+		}
+	}
+
+	return true;
+}
+
 bool UPushPawn_Action_Base::WantsPushPawnActionDebugDraw()
 {
 #if UE_ENABLE_DEBUG_DRAWING
@@ -0,0 +1,170 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "Abilities/PushPawn_Action_Continuous.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameFramework/Character.h"
+#include "Tasks/AbilityTask_PushPawnForce.h"
+#include "PushPawnStats.h"
+#include "PushStatics.h"
+
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawn_Action_Continuous)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Continuous Pushes"), STAT_PushPawnContinuousPushes, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Continuous Pushes Absorbed"), STAT_PushPawnContinuousPushesAbsorbed, STATGROUP_PushPawn);
+
+bool UPushPawn_Action_Continuous::ActivatePushPawnAbility(const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo,
+	const FGameplayEventData* TriggerEventData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawn_Action_Continuous::ActivatePushPawnAbility);
+
+	if (!Super::ActivatePushPawnAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData))
+	{
+		return false;
+	}
+
+	// Pushes accumulated on the movement component end immediately, there is nothing to continue
+	if (!IsActive())
+	{
+		return true;
+	}
+
+	ContinuousStartTime = GetWorld()->GetTimeSeconds();
+	LastContinuousPushTime = ContinuousStartTime;
+
+	// Server receives continued pushes from the predicting client as replicated target data
+	UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get();
+	if (ASC && ActorInfo->IsNetAuthority() && !ActorInfo->IsLocallyControlled())
+	{
+		const FPredictionKey ActivationKey = ActivationInfo.GetActivationPredictionKey();
+		ASC->AbilityTargetDataSetDelegate(Handle, ActivationKey).AddUObject(this, &ThisClass::OnContinuousPushTargetDataReceived);
+		ASC->CallReplicatedTargetDataDelegatesIfSet(Handle, ActivationKey);
+	}
+
+	return true;
+}
+
+void UPushPawn_Action_Continuous::EndAbility(const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo,
+	bool bReplicateEndAbility, bool bWasCancelled)
+{
+	if (UAbilitySystemComponent* ASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr)
+	{
+		ASC->AbilityTargetDataSetDelegate(Handle, ActivationInfo.GetActivationPredictionKey()).RemoveAll(this);
+	}
+
+	PushTask = nullptr;
+
+	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
+}
+
+bool UPushPawn_Action_Continuous::ConsumeContinuousPush(const FGameplayEventData& EventData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawn_Action_Continuous::ConsumeContinuousPush);
+
+	if (!IsActive() || !PushTask || PushTask->bIsFinished)
+	{
+		return false;
+	}
+
+	// Re-activate periodically
+	if (MaxContinuousDuration > 0.f && GetWorld()->TimeSince(ContinuousStartTime) >= MaxContinuousDuration)
+	{
+		return false;
+	}
+
+	// Only the predicting client (or locally controlled authority) originates pushes
+	const FGameplayAbilityActorInfo* ActorInfo = GetCurrentActorInfo();
+	if (!ActorInfo || !ActorInfo->IsLocallyControlled())
+	{
+		return false;
+	}
+
+	// Pusher changed, re-activate so the new pusher is cached
+	if (EventData.Target.Get() != Pusher.Get())
+	{
+		return false;
+	}
+
+	// Absorb pushes that follow closely, the active force is still pushing us away from the same pusher
+	const float PushInterval = FMath::Min(ContinuousPushInterval, PushParams.Duration * 0.5f);
+	if (PushInterval > 0.f && GetWorld()->TimeSince(LastContinuousPushTime) < PushInterval)
+	{
+		INC_DWORD_STAT(STAT_PushPawnContinuousPushesAbsorbed);
+		return true;
+	}
+
+	if (!ApplyContinuousPush(EventData.TargetData))
+	{
+		return false;
+	}
+
+	LastContinuousPushTime = GetWorld()->GetTimeSeconds();
+
+	// Send the push to the server, on the existing activation instead of a new one
+	UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get();
+	if (ASC && !ActorInfo->IsNetAuthority())
+	{
+		FScopedPredictionWindow ScopedPrediction(ASC, true);
+		ASC->ServerSetReplicatedTargetData(GetCurrentAbilitySpecHandle(),
+			GetCurrentActivationInfo().GetActivationPredictionKey(), EventData.TargetData, FGameplayTag(),
+			ASC->ScopedPredictionKey);
+	}
+
+	INC_DWORD_STAT(STAT_PushPawnContinuousPushes);
+	return true;
+}
+
+bool UPushPawn_Action_Continuous::ApplyContinuousPush(const FGameplayAbilityTargetDataHandle& TargetData)
+{
+	if (!PushTask || !IsValid(Pushee))
+	{
+		return false;
+	}
+
+	// Combine all pushes contained in the target data
+	FGameplayEventData EventData;
+	EventData.TargetData = TargetData;
+
+	const FVector PushForce = UPushStatics::AccumulateBatchedPushForce(Pushee, EventData, 0, PushParams);
+	if (PushForce.IsNearlyZero())
+	{
+		return false;
+	}
+
+	PushDirection = PushParams.bDistanceCheck2D ? PushForce.GetSafeNormal2D() : PushForce.GetSafeNormal();
+	Strength = PushForce.Size();
+
+	return PushTask->UpdatePushForce(PushDirection, Strength, PushParams.Duration);
+}
+
+void UPushPawn_Action_Continuous::OnContinuousPushTargetDataReceived(const FGameplayAbilityTargetDataHandle& TargetData,
+	FGameplayTag ApplicationTag)
+{
+	// Copy before consuming, the reference points to the cached data
+	const FGameplayAbilityTargetDataHandle Data = TargetData;
+
+	if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
+	{
+		ASC->ConsumeClientReplicatedTargetData(GetCurrentAbilitySpecHandle(), GetCurrentActivationInfo().GetActivationPredictionKey());
+	}
+
+	// Continued pushes are validated the same as activations
+	FGameplayEventData EventData;
+	EventData.Instigator = Pushee;
+	EventData.Target = Pusher;
+	EventData.TargetData = Data;
+	if (!ValidateClientPush(GetCurrentActorInfo(), Pushee, Pusher, EventData, PushParams.bDistanceCheck2D))
+	{
+		return;
+	}
+
+	if (IsActive())
+	{
+		ApplyContinuousPush(Data);
+	}
+}
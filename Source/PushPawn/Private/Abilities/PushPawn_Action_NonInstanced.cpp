@@ -0,0 +1,94 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "Abilities/PushPawn_Action_NonInstanced.h"
+
+#include "GameFramework/Pawn.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "PushPawnForceBackend.h"
+#include "PushStatics.h"
+
+#include "AbilitySystemLog.h"
+#include "DrawDebugHelpers.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawn_Action_NonInstanced)
+
+UPushPawn_Action_NonInstanced::UPushPawn_Action_NonInstanced(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::NonInstanced;
+}
+
+bool UPushPawn_Action_NonInstanced::ActivatePushPawnAbility(const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo,
+	const FGameplayEventData* TriggerEventData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawn_Action_NonInstanced::ActivatePushPawnAbility);
+
+	const FGameplayEventData& EventData = *TriggerEventData;
+
+	// Gather Pusher and Pushee
+	TObjectPtr<const APawn> Pushee = nullptr;
+	TObjectPtr<const APawn> Pusher = nullptr;
+	UPushStatics::GetPushPawnsFromEventDataChecked<APawn, APawn>(EventData, Pushee, Pusher);
+
+	// Check for null -- we can be destroyed during ability activation and crash!
+	if (!IsValid(Pushee) || !IsValid(Pusher))
+	{
+		ABILITY_LOG(Error, TEXT("PushPawn_Action_NonInstanced: Pushee or Pusher is null!"));
+		CancelAbility(Handle, ActorInfo, ActivationInfo, false);
+		return false;
+	}
+
+	// Check for valid movement component and mode, pawns without a character movement component need a force backend
+	UCharacterMovementComponent* MovementComponent = Cast<UCharacterMovementComponent>(Pushee->GetMovementComponent());
+	IPushPawnForceBackend* ForceBackend = MovementComponent ? nullptr :
+		UPushStatics::FindPushForceBackend(Pushee, PushParams.ForceBackend);
+	if (MovementComponent ? MovementComponent->MovementMode == MOVE_None : !ForceBackend)
+	{
+		CancelAbility(Handle, ActorInfo, ActivationInfo, false);
+		return false;
+	}
+
+	// Reject invalid pushes predicted by the client
+	if (!ValidateClientPush(ActorInfo, Pushee, Pusher, EventData, PushParams.bDistanceCheck2D))
+	{
+		CancelAbility(Handle, ActorInfo, ActivationInfo, true);
+		return false;
+	}
+
+	// Gather Push Data
+	FVector PushDirection;
+	float DistanceBetween, StrengthScalar;
+	bool bOverrideStrength;
+	UPushStatics::GetPushDataFromEventData(EventData, PushParams.bDistanceCheck2D, PushDirection,
+		DistanceBetween, StrengthScalar, bOverrideStrength);
+
+	// Push Strength
+	const float NormalizedDistance = UPushStatics::GetNormalizedPushDistance(Pushee, Pusher, DistanceBetween);
+	const float Strength = UPushStatics::CalculatePushStrength(Pushee, bOverrideStrength, StrengthScalar, NormalizedDistance, PushParams);
+
+	// Combine the forces from any batched pushes into a single push
+	FVector PushForce = PushDirection * Strength;
+	if (UPushStatics::GetNumPushesInEventData(EventData) > 1)
+	{
+		PushForce = UPushStatics::AccumulateBatchedPushForce(Pushee, EventData, 1, PushParams, PushForce);
+	}
+
+#if UE_ENABLE_DEBUG_DRAWING
+	if (WantsPushPawnActionDebugDraw())
+	{
+		DrawDebugDirectionalArrow(Pushee->GetWorld(), Pushee->GetActorLocation(),
+			Pushee->GetActorLocation() + PushForce.GetSafeNormal() * 100.f, 40.f, FColor::Magenta,
+			false, 1.0f);
+	}
+#endif
+
+	// Apply the push force directly using the selected force backend, there is no instance to own a task
+	UPushStatics::ApplyPushForceDirect(Pushee, PushForce, PushParams);
+
+	// Nothing left to do, the root motion source or force backend ends the push itself
+	EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
+
+	return true;
+}
@@ -5,16 +5,30 @@
 
 #include "AbilitySystemComponent.h"
 #include "Abilities/PushPawnAbilityTargetData.h"
+#include "Abilities/PushPawn_Action_Base.h"
 #include "NativeGameplayTags.h"
 #include "Tasks/AbilityTask_PushPawnScan.h"
 #include "IPush.h"
 #include "PushStatics.h"
 #include "PushPawnTags.h"
+#include "PushPawnStats.h"
+#include "PushPawnSubsystem.h"
+#include "PushPawnSpawnSeparationSubsystem.h"
+#include "PushPawnAISolverSubsystem.h"
 
 #include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "GameFramework/PlayerState.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawn_Scan_Base)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Push RPCs Saved By Batching"), STAT_PushPawnPushRPCsSaved, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Push Activations Saved By AI Solver"), STAT_PushPawnAISolverActivationsSaved, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Coincident Push Tie-Breaks"), STAT_PushPawnTieBreaks, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Net Syncs"), STAT_PushPawnNetSyncs, STATGROUP_PushPawn);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Net Sync Pause Time (ms)"), STAT_PushPawnNetSyncPauseTime, STATGROUP_PushPawn);
+
 UPushPawn_Scan_Base::UPushPawn_Scan_Base(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -36,6 +50,12 @@ void UPushPawn_Scan_Base::OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo
 {
 	Super::OnAvatarSet(ActorInfo, Spec);
 
+	// Resolve spawn overlaps by teleporting, before the scan starts pushing
+	if (bSeparateOnSpawn && ActorInfo->IsNetAuthority())
+	{
+		UPushPawnSpawnSeparationSubsystem::QueueSpawnSeparation(Cast<APawn>(ActorInfo->AvatarActor.Get()));
+	}
+
 	// If we're auto-activating, try to activate the ability
 	if (bAutoActivateOnGrantAbility)
 	{
@@ -68,24 +88,73 @@ bool UPushPawn_Scan_Base::ActivatePushPawnAbility(const FGameplayAbilitySpecHand
 void UPushPawn_Scan_Base::UpdatePushes(const TArray<FPushOption>& PushOptions)
 {
 	CurrentOptions = PushOptions;
+
+	// Pushes between AI on the server are solved in a batch, only pushes involving a player activate the action
+	if (IsUsingServerAISolver())
+	{
+		for (int32 i = CurrentOptions.Num() - 1; i >= 0; i--)
+		{
+			if (QueueServerAIPush(CurrentOptions[i]))
+			{
+				CurrentOptions.RemoveAt(i);
+				INC_DWORD_STAT(STAT_PushPawnAISolverActivationsSaved);
+			}
+		}
+	}
 }
 
-void UPushPawn_Scan_Base::TriggerPush()
+bool UPushPawn_Scan_Base::IsUsingServerAISolver() const
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawn_Scan_Base::TriggerPush);
+	return bUseServerAISolver && UPushPawnAISolverSubsystem::IsServerAIPawn(Cast<APawn>(GetAvatarActorFromActorInfo()));
+}
 
-	// If we have no options, we can't do anything
-	if (CurrentOptions.Num() == 0)
+bool UPushPawn_Scan_Base::QueueServerAIPush(const FPushOption& PushOption) const
+{
+	const APawn* PusherPawn = Cast<APawn>(UPushStatics::GetActorFromPushTarget(PushOption.PusherTarget));
+	if (!UPushPawnAISolverSubsystem::IsServerAIPawn(PusherPawn) || !PushOption.TargetAbilitySystem)
 	{
-		return;
+		return false;
 	}
 
-	// Get the first push option
-	const FPushOption& PushOption = CurrentOptions[0];
+	// The solver applies the push action's params without activating it
+	const FGameplayAbilitySpec* Spec = PushOption.TargetAbilitySystem->FindAbilitySpecFromHandle(PushOption.TargetPushAbilityHandle);
+	const UPushPawn_Action_Base* PushAction = Spec ? Cast<UPushPawn_Action_Base>(Spec->Ability) : nullptr;
+	if (!PushAction || !PushAction->GetPushActionParams())
+	{
+		return false;
+	}
+
+	// Blocked and required tags and cooldowns apply the same as an activation would
+	if (!PushAction->CanActivateAbility(Spec->Handle, PushOption.TargetAbilitySystem->AbilityActorInfo.Get()))
+	{
+		// Nothing to push, but it's still ours to handle
+		return true;
+	}
 
+	// Computing the target data runs the same push group and CanBePushedBy/CanPushPawn checks as an activation
+	const TSharedPtr<FGameplayAbilityTargetData> TargetData = MakePushTargetData(PushOption);
+	if (!TargetData.IsValid())
+	{
+		// Nothing to push, but it's still ours to handle
+		return true;
+	}
+
+	const FPushPawnPushTargetData* PushData = static_cast<const FPushPawnPushTargetData*>(TargetData.Get());
+
+	FPushPawnAISolverPush Push;
+	Push.Pushee = Cast<APawn>(GetAvatarActorFromActorInfo());
+	Push.Pusher = PusherPawn;
+	Push.PushAction = PushAction;
+	Push.StrengthScalar = PushData->StrengthScalar;
+	Push.bOverrideStrength = PushData->bOverrideStrength;
+	return UPushPawnAISolverSubsystem::QueuePush(GetWorld(), Push);
+}
+
+TSharedPtr<FGameplayAbilityTargetData> UPushPawn_Scan_Base::MakePushTargetData(const FPushOption& PushOption) const
+{
 	// Get the pushee and pusher actors
-	AActor* PusheeInstigatorActor = GetAvatarActorFromActorInfo();
-	AActor* PusherTargetActor = UPushStatics::GetActorFromPushTarget(PushOption.PusherTarget);
+	const AActor* PusheeInstigatorActor = GetAvatarActorFromActorInfo();
+	const AActor* PusherTargetActor = UPushStatics::GetActorFromPushTarget(PushOption.PusherTarget);
 
 	// The ability instigator that is being pushed
 	const IPusheeInstigator* PusheeInstigator = UPushStatics::GetPusheeInstigator(PusheeInstigatorActor);
@@ -93,6 +162,13 @@ void UPushPawn_Scan_Base::TriggerPush()
 	// The ability target that does the pushing
 	const IPusherTarget* PusherTarget = UPushStatics::GetPusherTarget(PusherTargetActor);
 
+	// Cheap O(1) push group check before calling into potentially expensive (or Blueprint) interface functions
+	if (PusheeInstigator && PusherTarget &&
+		!UPushPawnSubsystem::IsPushAllowedByGroup(GetWorld(), PusherTarget->GetPusherPushGroup(), PusheeInstigator->GetPusheePushGroup()))
+	{
+		return nullptr;
+	}
+
 	// Check if the pushee can be pushed by the pusher
 	const bool bCanBePushed = PusheeInstigator && PusheeInstigator->CanBePushedBy(PusherTargetActor);
 
@@ -102,7 +178,7 @@ void UPushPawn_Scan_Base::TriggerPush()
 	// If the pushee can't be pushed or the pusher can't push, we can't do anything
 	if (!bCanBePushed || !bCanPush)
 	{
-		return;
+		return nullptr;
 	}
 
 	// Use this to pass a Push direction, if we compute this later from the Payload Instigator or Target, it will
@@ -117,10 +193,9 @@ void UPushPawn_Scan_Base::TriggerPush()
 	{
 		// This typically occurs on spawning, when their location is the exact same, if we move them back along their
 		// forward vectors - they may just push forever in the same direction
-		const float RandomDegrees = FMath::RandRange(0.f, 360.f);
-		const float RandAngle = FMath::DegreesToRadians(RandomDegrees);
-		const FVector NewDirection { FMath::Cos(RandAngle), FMath::Sin(RandAngle), 0.f };
-		Direction = NewDirection.GetSafeNormal();
+		// A random direction would differ between client and server and cause a correction, so derive it from the pair
+		Direction = UPushStatics::GetTieBreakPushDirection(PusheeInstigatorActor, PusherTargetActor);
+		INC_DWORD_STAT(STAT_PushPawnTieBreaks);
 	}
 	
 	// Normalize the direction
@@ -180,48 +255,130 @@ void UPushPawn_Scan_Base::TriggerPush()
 		StrengthScalar = PusheeStrengthScalar * PusherStrengthScalar;
 	}
 	
-	// Allow the target to customize the event data we're about to pass in, in case the ability needs custom data
-	// that only the actor knows.
-	FPushPawnAbilityTargetData* TargetData = new FPushPawnAbilityTargetData(Direction, Distance);
+	// Direction, distance and strength are combined into a single pooled target data to avoid heap allocations,
+	// the distance is sent as a fraction of the combined radius so it can be quantized
+	const float NormalizedDistance = UPushStatics::GetNormalizedPushDistance(PusheeInstigatorActor, PusherTargetActor, Distance);
+	return FPushPawnTargetDataPool::Get().Acquire(Direction, NormalizedDistance, StrengthScalar, bStrengthOverride);
+}
+
+void UPushPawn_Scan_Base::TriggerPush()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawn_Scan_Base::TriggerPush);
+
+	// If we have no options, we can't do anything
+	if (CurrentOptions.Num() == 0)
+	{
+		return;
+	}
+
+	// Hold the push until the net sync completes, it will then trigger with whatever the latest options are, so
+	// only the latest push is kept
+	if (bNetSyncInProgress && NetSyncScanMode == EPushPawnNetSyncScanMode::Buffer)
+	{
+		bHasBufferedPush = true;
+		return;
+	}
+
+	// Get the first push option
+	const FPushOption& PushOption = CurrentOptions[0];
+
+	// Compute the push, this will fail if the pushee can't be pushed or the pusher can't push
+	const TSharedPtr<FGameplayAbilityTargetData> TargetData = MakePushTargetData(PushOption);
+	if (!TargetData.IsValid())
+	{
+		return;
+	}
+
+	// Get the pushee and pusher actors
+	AActor* PusheeInstigatorActor = GetAvatarActorFromActorInfo();
+	AActor* PusherTargetActor = UPushStatics::GetActorFromPushTarget(PushOption.PusherTarget);
 
 	// The payload data for the Push ability
 	FGameplayEventData Payload;
 	Payload.EventTag = FPushPawnTags::PushPawn_PushAbility_Activate;
 	Payload.Instigator = PusheeInstigatorActor;
 	Payload.Target = PusherTargetActor;
-	Payload.TargetData.Add(TargetData);
+	Payload.TargetData.Data.Add(TargetData);
 
-	// We only send the strength scalar if it's not 1.f to save on bandwidth
-	if (bStrengthOverride || !FMath::IsNearlyEqual(StrengthScalar, 1.f))
+	// Pushes that continue during a net sync are predicted ahead of the server, tag them so it knows
+	if (bNetSyncInProgress)
 	{
-		FPushPawnStrengthTargetData* StrengthTargetData = new FPushPawnStrengthTargetData(StrengthScalar, bStrengthOverride);
-		Payload.TargetData.Add(StrengthTargetData);
+		Payload.InstigatorTags.AddTag(FPushPawnTags::PushPawn_NetSync_Pending);
 	}
 
-	// If needed we allow the Push target to manipulate the event data
-	PushOption.PusherTarget->CustomizePushEventData(FPushPawnTags::PushPawn_PushAbility_Activate, Payload);
+	// Fold the remaining pushers into the same activation instead of each requiring their own RPC
+	if (bBatchPushes)
+	{
+		// A pusher can have options from both its own interface and its UPusherComponent, it only pushes once
+		TArray<const AActor*, TInlineAllocator<8>> BatchedPushers;
+		BatchedPushers.Add(PusherTargetActor);
+
+		for (int32 i = 1; i < CurrentOptions.Num() && Payload.TargetData.Num() < MaxBatchedPushes; i++)
+		{
+			// Can only batch pushes that activate the same ability
+			const FPushOption& BatchedOption = CurrentOptions[i];
+			if (BatchedOption.TargetAbilitySystem != PushOption.TargetAbilitySystem ||
+				BatchedOption.TargetPushAbilityHandle != PushOption.TargetPushAbilityHandle)
+			{
+				continue;
+			}
+
+			const AActor* BatchedPusher = UPushStatics::GetActorFromPushTarget(BatchedOption.PusherTarget);
+			if (BatchedPushers.Contains(BatchedPusher))
+			{
+				continue;
+			}
 
-	// Grab the target actor off the payload we're going to use it as the 'avatar' for the Push, and the
-	// source PushTarget actor as the owner actor.
-	AActor* TargetActor = const_cast<AActor*>(Payload.Target.Get());
+			if (const TSharedPtr<FGameplayAbilityTargetData> BatchedTargetData = MakePushTargetData(BatchedOption))
+			{
+				BatchedPushers.Add(BatchedPusher);
+				Payload.TargetData.Data.Add(BatchedTargetData);
+				PushRPCsSaved++;
+				INC_DWORD_STAT(STAT_PushPawnPushRPCsSaved);
+			}
+		}
+	}
 
-	// The actor info needed for the Push.
-	FGameplayAbilityActorInfo ActorInfo;
-	ActorInfo.InitFromActor(PusherTargetActor, TargetActor, PushOption.TargetAbilitySystem);
+	// If needed we allow the Push target to manipulate the event data
+	PushOption.PusherTarget->CustomizePushEventData(FPushPawnTags::PushPawn_PushAbility_Activate, Payload);
 
-	// Trigger the ability using event tag.
-	PushOption.TargetAbilitySystem->TriggerAbilityFromGameplayEvent(
-		PushOption.TargetPushAbilityHandle,
-		&ActorInfo,
-		FPushPawnTags::PushPawn_PushAbility_Activate,
-		&Payload,
-		*PushOption.TargetAbilitySystem
-	);
+	// If the push action is already active it may consume the push itself, instead of being re-triggered
+	if (!ConsumeContinuousPush(PushOption, Payload))
+	{
+		// Grab the target actor off the payload we're going to use it as the 'avatar' for the Push, and the
+		// source PushTarget actor as the owner actor.
+		AActor* TargetActor = const_cast<AActor*>(Payload.Target.Get());
+
+		// The actor info needed for the Push.
+		FGameplayAbilityActorInfo ActorInfo;
+		ActorInfo.InitFromActor(PusherTargetActor, TargetActor, PushOption.TargetAbilitySystem);
+
+		// Trigger the ability using event tag.
+		PushOption.TargetAbilitySystem->TriggerAbilityFromGameplayEvent(
+			PushOption.TargetPushAbilityHandle,
+			&ActorInfo,
+			FPushPawnTags::PushPawn_PushAbility_Activate,
+			&Payload,
+			*PushOption.TargetAbilitySystem
+		);
+	}
 
 	TriggeredPushesSinceLastNetSync++;
 	LastPushTime = GetWorld()->GetTimeSeconds();
 }
 
+bool UPushPawn_Scan_Base::ConsumeContinuousPush(const FPushOption& PushOption, const FGameplayEventData& Payload) const
+{
+	const FGameplayAbilitySpec* Spec = PushOption.TargetAbilitySystem->FindAbilitySpecFromHandle(PushOption.TargetPushAbilityHandle);
+	if (!Spec || !Spec->IsActive())
+	{
+		return false;
+	}
+
+	UPushPawn_Action_Base* ActiveAction = Cast<UPushPawn_Action_Base>(Spec->GetPrimaryInstance());
+	return ActiveAction && ActiveAction->ConsumeContinuousPush(Payload);
+}
+
 float UPushPawn_Scan_Base::GetBaseScanRange(const AActor* AvatarActor) const
 {
 	// If we allow blueprint implementation, call the blueprint method instead
@@ -240,24 +397,56 @@ bool UPushPawn_Scan_Base::ShouldWaitForNetSync() const
 	{
 		return false;
 	}
+
+	// Nobody is predicting an AI on the server, there is nothing to sync
+	if (IsUsingServerAISolver())
+	{
+		return false;
+	}
+
+	// Still scanning while the previous net sync is outstanding, don't stack another on top of it
+	if (bNetSyncInProgress)
+	{
+		return false;
+	}
+
+	float IntervalScale = 1.f;
+	if (bAdaptiveNetSync)
+	{
+		// The server can't measure the client's corrections, so it follows the client's schedule instead of its own
+		const FGameplayAbilityActorInfo* ActorInfo = GetCurrentActorInfo();
+		if (ActorInfo && ActorInfo->IsNetAuthority() && !ActorInfo->IsLocallyControlled())
+		{
+			return HasPendingClientNetSync();
+		}
+
+		// Don't sync again before the previous sync could have reached the server
+		if (MinNetSyncRoundTrips > 0.f && LastNetSyncTime >= 0.f &&
+			GetWorld()->TimeSince(LastNetSyncTime) < MinNetSyncRoundTrips * NetSyncRoundTripTime)
+		{
+			return false;
+		}
+
+		IntervalScale = NetSyncIntervalScale;
+	}
 	
 	// If a push occurred recently, don't sync just yet
 	if (MinNetSyncDelay > 0.f && LastPushTime >= 0.f &&
-		GetWorld()->TimeSince(LastPushTime) < MinNetSyncDelay)
+		GetWorld()->TimeSince(LastPushTime) < MinNetSyncDelay * IntervalScale)
 	{
 		return false;
 	}
 
 	// If too much time has passed since the last push, sync
 	if (NetSyncDelayAfterPush > 0.f && TriggeredPushesSinceLastNetSync > 0 &&
-		LastPushTime >= 0.f && GetWorld()->TimeSince(LastPushTime) >= NetSyncDelayAfterPush)
+		LastPushTime >= 0.f && GetWorld()->TimeSince(LastPushTime) >= NetSyncDelayAfterPush * IntervalScale)
 	{
 		return true;
 	}
 
 	// If too much time has passed without a push, sync
 	if (NetSyncDelayWithoutPush > 0.f && TriggeredPushesSinceLastNetSync == 0 &&
-		LastNetSyncTime >= 0.f && GetWorld()->TimeSince(LastNetSyncTime) >= NetSyncDelayWithoutPush)
+		LastNetSyncTime >= 0.f && GetWorld()->TimeSince(LastNetSyncTime) >= NetSyncDelayWithoutPush * IntervalScale)
 	{
 		return true;
 	}
@@ -267,16 +456,106 @@ bool UPushPawn_Scan_Base::ShouldWaitForNetSync() const
 	{
 		return false;
 	}
-	return TriggeredPushesSinceLastNetSync > MaxPushesUntilNetSync;
+	return TriggeredPushesSinceLastNetSync > FMath::Max(1, FMath::RoundToInt(MaxPushesUntilNetSync * IntervalScale));
 }
 
 void UPushPawn_Scan_Base::ConsumeWaitForNetSync()
 {
+	if (bAdaptiveNetSync)
+	{
+		UpdateAdaptiveNetSync();
+	}
+
 	TriggeredPushesSinceLastNetSync = 0;
 	LastPushTime = -1.f;
 	LastNetSyncTime = GetWorld()->GetTimeSeconds();
 }
 
+void UPushPawn_Scan_Base::OnNetSyncStarted()
+{
+	bNetSyncInProgress = NetSyncScanMode != EPushPawnNetSyncScanMode::Pause;
+}
+
+void UPushPawn_Scan_Base::OnNetSyncFinished(float PauseTime)
+{
+	NumNetSyncs++;
+	NetSyncPauseTime += PauseTime;
+
+	INC_DWORD_STAT(STAT_PushPawnNetSyncs);
+	INC_FLOAT_STAT_BY(STAT_PushPawnNetSyncPauseTime, PauseTime * 1000.f);
+
+	bNetSyncInProgress = false;
+
+	// Trigger the held push now that the net sync completed
+	if (bHasBufferedPush)
+	{
+		bHasBufferedPush = false;
+		TriggerPush();
+	}
+}
+
+void UPushPawn_Scan_Base::UpdateAdaptiveNetSync()
+{
+	// Only the predicting client receives corrections
+	const FGameplayAbilityActorInfo* ActorInfo = GetCurrentActorInfo();
+	if (!ActorInfo || ActorInfo->IsNetAuthority() || !ActorInfo->IsLocallyControlled())
+	{
+		return;
+	}
+
+	const APawn* Pawn = Cast<APawn>(ActorInfo->AvatarActor.Get());
+	if (!Pawn)
+	{
+		return;
+	}
+
+	// PlayerState ping is the round trip time in milliseconds
+	if (const APlayerState* PlayerState = Pawn->GetPlayerState())
+	{
+		NetSyncRoundTripTime = PlayerState->GetPingInMilliseconds() * 0.001f;
+	}
+
+	const IPushPawnMovementAccumulator* Accumulator = Cast<IPushPawnMovementAccumulator>(Pawn->GetMovementComponent());
+	const int32 NumClientCorrections = Accumulator ? Accumulator->GetNumClientCorrections() : INDEX_NONE;
+	if (NumClientCorrections == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Without any pushes there is nothing to learn about how well pushes are predicted
+	if (TriggeredPushesSinceLastNetSync > 0 && LastNumClientCorrections != INDEX_NONE)
+	{
+		const bool bPushCorrected = NumClientCorrections > LastNumClientCorrections;
+		NetSyncIntervalScale *= bPushCorrected ? NetSyncIntervalShrink : NetSyncIntervalGrowth;
+		NetSyncIntervalScale = FMath::Clamp(NetSyncIntervalScale, MinNetSyncIntervalScale, MaxNetSyncIntervalScale);
+	}
+	LastNumClientCorrections = NumClientCorrections;
+}
+
+bool UPushPawn_Scan_Base::HasPendingClientNetSync() const
+{
+	// The client's net syncs may be sent with its moves, @see UAbilityTask_PushPawnSync
+	const APawn* Pawn = Cast<APawn>(GetAvatarActorFromActorInfo());
+	const IPushPawnSyncEpochProvider* SyncEpochProvider = Pawn ? Cast<IPushPawnSyncEpochProvider>(Pawn->GetMovementComponent()) : nullptr;
+	if (SyncEpochProvider && SyncEpochProvider->IsPushSyncEpochEnabled())
+	{
+		const uint8 NextEpoch = SyncEpochProvider->GetAwaitedPushSyncEpoch() + 1;
+		return IPushPawnSyncEpochProvider::HasReachedPushSyncEpoch(SyncEpochProvider->GetReceivedPushSyncEpoch(), NextEpoch);
+	}
+
+	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
+	if (!ASC)
+	{
+		return false;
+	}
+
+	// Set by UAbilityTask_PushPawnSync on the client, the server's sync task will consume it immediately
+	const FAbilityReplicatedData ReplicatedData = ASC->GetReplicatedDataOfGenericReplicatedEvent(
+		EAbilityGenericReplicatedEvent::GenericSignalFromClient, GetCurrentAbilitySpecHandle(),
+		GetCurrentActivationInfo().GetActivationPredictionKey());
+	return ReplicatedData.bTriggered;
+}
+
 float UPushPawn_Scan_Base::K2_GetBaseScanRange_Implementation(const AActor* AvatarActor) const
 {
 	// Default to max collision shape size
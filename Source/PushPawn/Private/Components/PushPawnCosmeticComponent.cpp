@@ -0,0 +1,74 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "Components/PushPawnCosmeticComponent.h"
+
+#include "PushPawnCosmeticSubsystem.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnCosmeticComponent)
+
+void UPushPawnCosmeticComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Purely visual, the server has nothing to draw
+	if (CharacterOwner && GetNetMode() != NM_DedicatedServer)
+	{
+		UPushPawnCosmeticSubsystem::RegisterComponent(this);
+	}
+}
+
+void UPushPawnCosmeticComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UPushPawnCosmeticSubsystem::UnregisterComponent(this);
+	ResetCosmeticOffset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool UPushPawnCosmeticComponent::WantsCosmeticPush() const
+{
+	return CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_SimulatedProxy && CharacterOwner->GetMesh();
+}
+
+void UPushPawnCosmeticComponent::UpdateCosmeticOffset(float DeltaTime)
+{
+	const FVector NewOffset = FMath::VInterpTo(CurrentOffset, TargetOffset, DeltaTime, CosmeticInterpSpeed);
+	ApplyCosmeticOffset(NewOffset.IsNearlyZero(0.1f) && TargetOffset.IsZero() ? FVector::ZeroVector : NewOffset);
+}
+
+void UPushPawnCosmeticComponent::ResetCosmeticOffset()
+{
+	TargetOffset = FVector::ZeroVector;
+	ApplyCosmeticOffset(FVector::ZeroVector);
+}
+
+void UPushPawnCosmeticComponent::ApplyCosmeticOffset(const FVector& WorldOffset)
+{
+	CurrentOffset = WorldOffset;
+
+	USkeletalMeshComponent* Mesh = CharacterOwner ? CharacterOwner->GetMesh() : nullptr;
+	if (!Mesh || !CharacterOwner->GetCapsuleComponent())
+	{
+		AppliedRelativeOffset = FVector::ZeroVector;
+		return;
+	}
+
+	const FVector RelativeOffset = CharacterOwner->GetCapsuleComponent()->GetComponentQuat().UnrotateVector(WorldOffset);
+	if (RelativeOffset.Equals(AppliedRelativeOffset))
+	{
+		return;
+	}
+
+	// Network smoothing interpolates the mesh towards the base translation offset, so move it along with the mesh,
+	// otherwise smoothing would undo the offset, or the offset would be baked into the mesh when smoothing is idle
+	const FVector DeltaOffset = RelativeOffset - AppliedRelativeOffset;
+	CharacterOwner->CacheInitialMeshOffset(CharacterOwner->GetBaseTranslationOffset() + DeltaOffset,
+		CharacterOwner->GetBaseRotationOffset().Rotator());
+	Mesh->AddRelativeLocation(DeltaOffset);
+	AppliedRelativeOffset = RelativeOffset;
+}
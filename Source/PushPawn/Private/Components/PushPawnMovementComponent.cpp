@@ -0,0 +1,317 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "Components/PushPawnMovementComponent.h"
+
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "PushPawnStats.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnMovementComponent)
+
+DECLARE_CYCLE_STAT(TEXT("Apply Push Velocity"), STAT_PushPawnApplyPushVelocity, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pushes Accumulated"), STAT_PushPawnPushesAccumulated, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Moves Sent With Push"), STAT_PushPawnMovesSentWithPush, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Unauthorized Move Pushes"), STAT_PushPawnUnauthorizedMovePushes, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Late Authorized Move Pushes"), STAT_PushPawnLateAuthorizedMovePushes, STATGROUP_PushPawn);
+
+namespace PushPawnMovement
+{
+	/** The client's push may differ in direction from the authorized push by up to 60 degrees, e.g. due to batching */
+	static constexpr float MinAuthorizedPushDot = 0.5f;
+}
+
+void FSavedMove_PushPawn::Clear()
+{
+	Super::Clear();
+
+	SavedPushVelocity = FVector::ZeroVector;
+	SavedPushSyncEpoch = 0;
+}
+
+void FSavedMove_PushPawn::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel,
+	FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	// Captured before PerformMovement() consumes it
+	if (const UPushPawnMovementComponent* MoveComp = Cast<UPushPawnMovementComponent>(C->GetCharacterMovement()))
+	{
+		SavedPushVelocity = MoveComp->GetPendingPushVelocity();
+		SavedPushSyncEpoch = MoveComp->GetPushSyncEpoch();
+	}
+}
+
+void FSavedMove_PushPawn::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	// Re-apply the push when replaying this move after a correction
+	if (UPushPawnMovementComponent* MoveComp = Cast<UPushPawnMovementComponent>(C->GetCharacterMovement()))
+	{
+		MoveComp->SetPendingPushVelocity(SavedPushVelocity);
+	}
+}
+
+bool FSavedMove_PushPawn::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	// Combining would drop one of the pushes
+	const FSavedMove_PushPawn* NewPushMove = static_cast<const FSavedMove_PushPawn*>(NewMove.Get());
+	if (!SavedPushVelocity.IsZero() || !NewPushMove->SavedPushVelocity.IsZero())
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+bool FSavedMove_PushPawn::IsImportantMove(const FSavedMovePtr& LastAckedMove) const
+{
+	// A push only exists in the move it was applied in, it must not be dropped
+	return !SavedPushVelocity.IsZero() || Super::IsImportantMove(LastAckedMove);
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_PushPawn::AllocateNewMove()
+{
+	return MakeShared<FSavedMove_PushPawn>();
+}
+
+void FPushPawnNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove,
+	ENetworkMoveType MoveType)
+{
+	Super::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+	const FSavedMove_PushPawn& PushPawnMove = static_cast<const FSavedMove_PushPawn&>(ClientMove);
+	PushVelocity = PushPawnMove.SavedPushVelocity;
+	PushSyncEpoch = PushPawnMove.SavedPushSyncEpoch;
+}
+
+bool FPushPawnNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar,
+	UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+	Super::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+	// Most moves have no push, only pay for the vector when there is one
+	bool bHasPush = !PushVelocity.IsZero();
+	Ar.SerializeBits(&bHasPush, 1);
+
+	bool bOutSuccess = true;
+	if (bHasPush)
+	{
+		PushVelocity.NetSerialize(Ar, PackageMap, bOutSuccess);
+	}
+	else if (Ar.IsLoading())
+	{
+		PushVelocity = FVector::ZeroVector;
+	}
+
+	if (bHasPush && Ar.IsSaving())
+	{
+		INC_DWORD_STAT(STAT_PushPawnMovesSentWithPush);
+	}
+
+	// Server and client agree on this, it's a defaults only property
+	const UPushPawnMovementComponent* PushPawnMovement = Cast<UPushPawnMovementComponent>(&CharacterMovement);
+	if (PushPawnMovement && PushPawnMovement->IsPushSyncEpochEnabled())
+	{
+		Ar << PushSyncEpoch;
+	}
+
+	return !Ar.IsError() && bOutSuccess;
+}
+
+FPushPawnNetworkMoveDataContainer::FPushPawnNetworkMoveDataContainer()
+{
+	NewMoveData = &PushPawnMoveData[0];
+	PendingMoveData = &PushPawnMoveData[1];
+	OldMoveData = &PushPawnMoveData[2];
+}
+
+UPushPawnMovementComponent::UPushPawnMovementComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SetNetworkMoveDataContainer(PushPawnMoveDataContainer);
+}
+
+void UPushPawnMovementComponent::AddPushVelocity(const FVector& DeltaVelocity)
+{
+	PendingPushVelocity += DeltaVelocity;
+	INC_DWORD_STAT(STAT_PushPawnPushesAccumulated);
+}
+
+void UPushPawnMovementComponent::AuthorizePushVelocity(const FVector& DeltaVelocity)
+{
+	if (GetWorld() && GetWorld()->TimeSince(LastPushAuthorizationTime) > PushAuthorizationTimeout)
+	{
+		AuthorizedPushVelocity = FVector::ZeroVector;
+	}
+
+	AuthorizedPushVelocity += DeltaVelocity;
+	LastPushAuthorizationTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+
+	// A move carrying this push arrived before its activation, apply it with the client's next move
+	if (!UnclaimedPushVelocity.IsZero())
+	{
+		if (GetWorld() && GetWorld()->TimeSince(LastUnclaimedPushTime) <= PushAuthorizationTimeout)
+		{
+			const FVector ClaimedPushVelocity = ConsumeAuthorizedPushVelocity(UnclaimedPushVelocity);
+			if (!ClaimedPushVelocity.IsZero())
+			{
+				PendingPushVelocity += ClaimedPushVelocity;
+				INC_DWORD_STAT(STAT_PushPawnLateAuthorizedMovePushes);
+			}
+		}
+		UnclaimedPushVelocity = FVector::ZeroVector;
+	}
+}
+
+FVector UPushPawnMovementComponent::ConsumeAuthorizedPushVelocity(const FVector& ClientPushVelocity)
+{
+	if (ClientPushVelocity.IsZero())
+	{
+		return FVector::ZeroVector;
+	}
+
+	// An expired allowance can't be claimed
+	if (GetWorld() && GetWorld()->TimeSince(LastPushAuthorizationTime) > PushAuthorizationTimeout)
+	{
+		AuthorizedPushVelocity = FVector::ZeroVector;
+	}
+
+	// Pushes the server never activated or rejected, not activated yet, or pushing in a different direction
+	if (AuthorizedPushVelocity.IsNearlyZero() ||
+		(ClientPushVelocity.GetSafeNormal() | AuthorizedPushVelocity.GetSafeNormal()) < PushPawnMovement::MinAuthorizedPushDot)
+	{
+		return FVector::ZeroVector;
+	}
+
+	// Never more than was authorized, the remainder can be claimed by a later move
+	const FVector AcceptedPushVelocity = ClientPushVelocity.GetClampedToMaxSize(AuthorizedPushVelocity.Size());
+	AuthorizedPushVelocity -= AcceptedPushVelocity;
+	return AcceptedPushVelocity;
+}
+
+FNetworkPredictionData_Client* UPushPawnMovementComponent::GetPredictionData_Client() const
+{
+	if (ClientPredictionData == nullptr)
+	{
+		UPushPawnMovementComponent* MutableThis = const_cast<UPushPawnMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_PushPawn(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+void UPushPawnMovementComponent::CalcVelocity(float DeltaTime, float Friction, bool bFluid, float BrakingDeceleration)
+{
+	Super::CalcVelocity(DeltaTime, Friction, bFluid, BrakingDeceleration);
+
+	if (!PendingPushVelocity.IsZero() && !HasAnimRootMotion())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PushPawnApplyPushVelocity);
+
+		FVector PushVelocity = PendingPushVelocity;
+		if (bIgnorePushZ || IsMovingOnGround())
+		{
+			PushVelocity.Z = 0.f;
+		}
+		Velocity += PushVelocity;
+
+		// Consumed, sub-steps must not apply it again
+		PendingPushVelocity = FVector::ZeroVector;
+	}
+}
+
+void UPushPawnMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags,
+	const FVector& NewAccel)
+{
+	// The server applies the push the client sent with this move, limited to what its own validated activations allow
+	if (const FPushPawnNetworkMoveData* MoveData = static_cast<const FPushPawnNetworkMoveData*>(GetCurrentNetworkMoveData()))
+	{
+		const FVector AcceptedPushVelocity = ConsumeAuthorizedPushVelocity(MoveData->PushVelocity);
+		PendingPushVelocity += AcceptedPushVelocity;
+
+		// The activation RPC and the move aren't ordered, hold the push until its activation authorizes it
+		if (AcceptedPushVelocity.IsZero() && !MoveData->PushVelocity.IsZero())
+		{
+			const UWorld* World = GetWorld();
+			if (UnclaimedPushVelocity.IsZero() || (World && World->TimeSince(LastUnclaimedPushTime) > PushAuthorizationTimeout))
+			{
+				UnclaimedPushVelocity = FVector::ZeroVector;
+				LastUnclaimedPushTime = World ? World->GetTimeSeconds() : 0.f;
+			}
+			UnclaimedPushVelocity += MoveData->PushVelocity;
+			INC_DWORD_STAT(STAT_PushPawnUnauthorizedMovePushes);
+		}
+
+		// The client reached a new net sync, let the waiting sync task know once we're out of the move
+		if (bSendNetSyncWithMoves && !HasReachedPushSyncEpoch(ReceivedPushSyncEpoch, MoveData->PushSyncEpoch))
+		{
+			ReceivedPushSyncEpoch = MoveData->PushSyncEpoch;
+			if (const UWorld* World = GetWorld())
+			{
+				World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this]
+				{
+					PushSyncEpochReceivedDelegate.Broadcast();
+				}));
+			}
+		}
+	}
+
+	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+}
+
+void UPushPawnMovementComponent::OnMovementUpdated(float DeltaSeconds, const FVector& OldLocation,
+	const FVector& OldVelocity)
+{
+	Super::OnMovementUpdated(DeltaSeconds, OldLocation, OldVelocity);
+
+	// Only CalcVelocity() applies the push, a push this move's mode skipped must not carry over into later moves
+	PendingPushVelocity = FVector::ZeroVector;
+}
+
+void UPushPawnMovementComponent::ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse)
+{
+	// Only corrections that may have been caused by a push count, adaptive net sync must not tighten because of
+	// corrections that pushing had nothing to do with. Checked before Super acknowledges the moves
+	if (!MoveResponse.IsGoodMove() && HasPushMoveBefore(MoveResponse.ClientAdjustment.TimeStamp))
+	{
+		NumClientCorrections++;
+	}
+
+	Super::ClientHandleMoveResponse(MoveResponse);
+}
+
+bool UPushPawnMovementComponent::HasPushMoveBefore(float TimeStamp) const
+{
+	const FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+	if (!ClientData)
+	{
+		return false;
+	}
+
+	auto HasPush = [](const FSavedMovePtr& SavedMove)
+	{
+		return SavedMove.IsValid() && !static_cast<const FSavedMove_PushPawn*>(SavedMove.Get())->SavedPushVelocity.IsZero();
+	};
+
+	if (HasPush(ClientData->LastAckedMove))
+	{
+		return true;
+	}
+
+	for (const FSavedMovePtr& SavedMove : ClientData->SavedMoves)
+	{
+		if (!SavedMove.IsValid() || SavedMove->TimeStamp > TimeStamp)
+		{
+			break;
+		}
+
+		if (HasPush(SavedMove))
+		{
+			return true;
+		}
+	}
+	return false;
+}
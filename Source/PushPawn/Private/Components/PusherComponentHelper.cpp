@@ -5,9 +5,89 @@
 
 #include "PushStatics.h"
 
+#include "Engine/World.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PusherComponentHelper)
 
+float UPusherComponentHelper::GetCacheTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.f;
+}
+
+void UPusherComponentHelper::InvalidatePushCache()
+{
+	CachedPushAbility = nullptr;
+	CachedPushAbilityTime = -1.f;
+	CachedPushCapable.Reset();
+	CachedCanPushPawn.Reset();
+}
+
 void UPusherComponentHelper::GatherPushOptions(const FPushQuery& PushQuery, FPushOptionBuilder& OptionBuilder)
 {
-	UPushStatics::GatherPushOptions(K2_GetPushAbility(), PawnOwner, PushQuery, OptionBuilder);
+	if (!bCachePushAbility)
+	{
+		UPushStatics::GatherPushOptions(K2_GetPushAbility(), PawnOwner, PushQuery, OptionBuilder);
+		return;
+	}
+
+	// Only call into Blueprint if we have nothing cached or the refresh interval has passed
+	const float Time = GetCacheTime();
+	const bool bRefreshIntervalPassed = PushAbilityRefreshInterval > 0.f && Time - CachedPushAbilityTime >= PushAbilityRefreshInterval;
+	if (CachedPushAbilityTime < 0.f || bRefreshIntervalPassed)
+	{
+		CachedPushAbility = K2_GetPushAbility();
+		CachedPushAbilityTime = Time;
+	}
+
+	UPushStatics::GatherPushOptions(CachedPushAbility, PawnOwner, PushQuery, OptionBuilder);
+}
+
+bool UPusherComponentHelper::IsPushCapable() const
+{
+	if (!bCachePushCapability)
+	{
+		return K2_IsPushCapable();
+	}
+
+	const float Time = GetCacheTime();
+	if (!CachedPushCapable.IsSet() || Time - CachedPushCapable->Time >= PushCapabilityCacheTTL)
+	{
+		CachedPushCapable = FPushPawnCachedResult { K2_IsPushCapable(), Time };
+	}
+	return CachedPushCapable->bResult;
+}
+
+bool UPusherComponentHelper::CanPushPawn(const AActor* PusheeActor) const
+{
+	if (!bCachePushCapability)
+	{
+		return K2_CanPushPawn(PusheeActor);
+	}
+
+	const float Time = GetCacheTime();
+	const TObjectKey<AActor> PusheeKey(PusheeActor);
+	if (const FPushPawnCachedResult* Cached = CachedCanPushPawn.Find(PusheeKey))
+	{
+		if (Time - Cached->Time < PushCapabilityCacheTTL)
+		{
+			return Cached->bResult;
+		}
+	}
+
+	// Discard expired results so the cache doesn't grow with every pawn we've ever touched
+	if (CachedCanPushPawn.Num() >= 16)
+	{
+		for (auto It = CachedCanPushPawn.CreateIterator(); It; ++It)
+		{
+			if (Time - It.Value().Time >= PushCapabilityCacheTTL)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	const bool bResult = K2_CanPushPawn(PusheeActor);
+	CachedCanPushPawn.Add(PusheeKey, FPushPawnCachedResult { bResult, Time });
+	return bResult;
 }
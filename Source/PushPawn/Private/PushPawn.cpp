@@ -2,17 +2,30 @@
 
 #include "PushPawn.h"
 
+#include "PushPawnPhysicsForceBackend.h"
+#include "Features/IModularFeatures.h"
+
 #define LOCTEXT_NAMESPACE "FPushPawnModule"
 
 void FPushPawnModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+	// Push pawns whose root is a simulating primitive, e.g. vehicles and physics driven creatures
+	PhysicsForceBackend = MakeUnique<FPushPawnPhysicsForceBackend>();
+	IModularFeatures::Get().RegisterModularFeature(IPushPawnForceBackend::GetModularFeatureName(), PhysicsForceBackend.Get());
 }
 
 void FPushPawnModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	if (PhysicsForceBackend.IsValid())
+	{
+		IModularFeatures::Get().UnregisterModularFeature(IPushPawnForceBackend::GetModularFeatureName(), PhysicsForceBackend.Get());
+		PhysicsForceBackend.Reset();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
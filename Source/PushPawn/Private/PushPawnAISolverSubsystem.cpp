@@ -0,0 +1,109 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnAISolverSubsystem.h"
+
+#include "Abilities/PushPawn_Action_Base.h"
+#include "PushPawnStats.h"
+#include "PushStatics.h"
+#include "PushTypes.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnAISolverSubsystem)
+
+DECLARE_CYCLE_STAT(TEXT("AI Solver Tick"), STAT_PushPawnAISolverTick, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI Solver Pushes"), STAT_PushPawnAISolverPushes, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI Solver Pawns Pushed"), STAT_PushPawnAISolverPawnsPushed, STATGROUP_PushPawn);
+
+UPushPawnAISolverSubsystem* UPushPawnAISolverSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UPushPawnAISolverSubsystem>() : nullptr;
+}
+
+bool UPushPawnAISolverSubsystem::QueuePush(const UWorld* World, const FPushPawnAISolverPush& Push)
+{
+	UPushPawnAISolverSubsystem* Subsystem = Get(World);
+	if (!Subsystem)
+	{
+		return false;
+	}
+
+	Subsystem->QueuedPushes.Add(Push);
+	return true;
+}
+
+bool UPushPawnAISolverSubsystem::IsServerAIPawn(const APawn* Pawn)
+{
+	return Pawn && Pawn->HasAuthority() && !Pawn->IsPlayerControlled();
+}
+
+void UPushPawnAISolverSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (QueuedPushes.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawnAISolverSubsystem::Tick);
+	SCOPE_CYCLE_COUNTER(STAT_PushPawnAISolverTick);
+	INC_DWORD_STAT_BY(STAT_PushPawnAISolverPushes, QueuedPushes.Num());
+
+	// Group pushes by pushee so each pushee receives a single combined push, hashes can collide so sort by key
+	QueuedPushes.Sort([](const FPushPawnAISolverPush& A, const FPushPawnAISolverPush& B)
+	{
+		return FObjectKey(A.Pushee.Get()) < FObjectKey(B.Pushee.Get());
+	});
+
+	int32 PushIndex = 0;
+	while (PushIndex < QueuedPushes.Num())
+	{
+		const FPushPawnAISolverPush& FirstPush = QueuedPushes[PushIndex];
+		const APawn* Pushee = FirstPush.Pushee.Get();
+		const UPushPawn_Action_Base* PushAction = FirstPush.PushAction.Get();
+		const FPushPawnActionParams* Params = PushAction ? PushAction->GetPushActionParams() : nullptr;
+
+		FVector PushForce = FVector::ZeroVector;
+		for (; PushIndex < QueuedPushes.Num() && QueuedPushes[PushIndex].Pushee == FirstPush.Pushee; PushIndex++)
+		{
+			const FPushPawnAISolverPush& Push = QueuedPushes[PushIndex];
+			const APawn* Pusher = Push.Pusher.Get();
+			if (!IsValid(Pushee) || !IsValid(Pusher) || !Params)
+			{
+				continue;
+			}
+
+			// Recompute from current positions, the scan that queued the push may be a frame or more old
+			FVector Direction = Pushee->GetActorLocation() - Pusher->GetActorLocation();
+			const float Distance = Params->bDistanceCheck2D ? Direction.Size2D() : Direction.Size();
+			Direction = Params->bDistanceCheck2D ? Direction.GetSafeNormal2D() : Direction.GetSafeNormal();
+			if (Direction.IsNearlyZero())
+			{
+				Direction = UPushStatics::GetTieBreakPushDirection(Pushee, Pusher);
+			}
+
+			const float NormalizedDistance = UPushStatics::GetNormalizedPushDistance(Pushee, Pusher, Distance);
+			PushForce += Direction * UPushStatics::CalculatePushStrength(Pushee, Push.bOverrideStrength,
+				Push.StrengthScalar, NormalizedDistance, *Params);
+		}
+
+		if (Params && !PushForce.IsNearlyZero() && UPushStatics::ApplyPushForceDirect(Pushee, PushForce, *Params))
+		{
+			INC_DWORD_STAT(STAT_PushPawnAISolverPawnsPushed);
+		}
+	}
+
+	QueuedPushes.Reset();
+}
+
+TStatId UPushPawnAISolverSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPushPawnAISolverSubsystem, STATGROUP_Tickables);
+}
+
+bool UPushPawnAISolverSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,226 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnCosmeticSubsystem.h"
+
+#include "Components/PushPawnCosmeticComponent.h"
+#include "PushPawnStats.h"
+#include "PushStatics.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnCosmeticSubsystem)
+
+DECLARE_CYCLE_STAT(TEXT("Cosmetic Solver Tick"), STAT_PushPawnCosmeticTick, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cosmetic Pawns Solved"), STAT_PushPawnCosmeticSolved, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cosmetic Pawns Culled"), STAT_PushPawnCosmeticCulled, STATGROUP_PushPawn);
+
+namespace FPushPawnCVars
+{
+	static bool bPushPawnCosmeticEnabled = true;
+	FAutoConsoleVariableRef CVarPushPawnCosmeticEnabled(
+		TEXT("p.PushPawn.Cosmetic.Enable"),
+		bPushPawnCosmeticEnabled,
+		TEXT("Enable cosmetic pushes for simulated proxies with a UPushPawnCosmeticComponent.\n"),
+		ECVF_Default);
+
+	static int32 PushPawnCosmeticMaxPawnsPerFrame = 32;
+	FAutoConsoleVariableRef CVarPushPawnCosmeticMaxPawnsPerFrame(
+		TEXT("p.PushPawn.Cosmetic.MaxPawnsPerFrame"),
+		PushPawnCosmeticMaxPawnsPerFrame,
+		TEXT("Maximum number of simulated proxies that compute a new cosmetic offset each frame, the rest keep their previous offset.\n"),
+		ECVF_Default);
+
+	static float PushPawnCosmeticCullDistance = 3000.f;
+	FAutoConsoleVariableRef CVarPushPawnCosmeticCullDistance(
+		TEXT("p.PushPawn.Cosmetic.CullDistance"),
+		PushPawnCosmeticCullDistance,
+		TEXT("Pawns further than this from the local viewpoint don't receive cosmetic pushes. 0 to disable culling.\n"),
+		ECVF_Default);
+}
+
+UPushPawnCosmeticSubsystem* UPushPawnCosmeticSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UPushPawnCosmeticSubsystem>() : nullptr;
+}
+
+void UPushPawnCosmeticSubsystem::RegisterComponent(UPushPawnCosmeticComponent* Component)
+{
+	if (UPushPawnCosmeticSubsystem* Subsystem = Component ? Get(Component->GetWorld()) : nullptr)
+	{
+		Subsystem->Components.AddUnique(Component);
+	}
+}
+
+void UPushPawnCosmeticSubsystem::UnregisterComponent(UPushPawnCosmeticComponent* Component)
+{
+	if (UPushPawnCosmeticSubsystem* Subsystem = Component ? Get(Component->GetWorld()) : nullptr)
+	{
+		Subsystem->Components.RemoveSingleSwap(Component);
+	}
+}
+
+void UPushPawnCosmeticSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Components.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawnCosmeticSubsystem::Tick);
+	SCOPE_CYCLE_COUNTER(STAT_PushPawnCosmeticTick);
+
+	struct FCosmeticBody
+	{
+		UPushPawnCosmeticComponent* Component;
+		FVector Location;
+		float Radius;
+		bool bSimulatedProxy;
+	};
+
+	// Cull around the local viewpoint
+	FVector ViewLocation = FVector::ZeroVector;
+	FRotator ViewRotation;
+	const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	const float CullDistance = FPushPawnCVars::PushPawnCosmeticCullDistance;
+	const bool bCull = PC && CullDistance > 0.f;
+	if (bCull)
+	{
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	}
+
+	TArray<FCosmeticBody, TInlineAllocator<64>> Bodies;
+	float MaxRadius = 0.f;
+	for (int32 i = Components.Num() - 1; i >= 0; i--)
+	{
+		UPushPawnCosmeticComponent* Component = Components[i];
+		const ACharacter* Character = IsValid(Component) ? Component->CharacterOwner.Get() : nullptr;
+		if (!Character)
+		{
+			Components.RemoveAtSwap(i);
+			continue;
+		}
+
+		const bool bSimulatedProxy = FPushPawnCVars::bPushPawnCosmeticEnabled && Component->WantsCosmeticPush();
+		const FVector Location = Character->GetActorLocation();
+		if (bCull && FVector::DistSquared(Location, ViewLocation) > FMath::Square(CullDistance))
+		{
+			// Relax back to the capsule instead of popping, it may come back into range
+			if (Component->HasCosmeticOffset())
+			{
+				Component->SetTargetOffset(FVector::ZeroVector);
+				Component->UpdateCosmeticOffset(DeltaTime);
+			}
+			INC_DWORD_STAT(STAT_PushPawnCosmeticCulled);
+			continue;
+		}
+
+		// Pawns that are no longer simulated proxies, e.g. after possession, return to their capsule
+		if (!bSimulatedProxy && Component->HasCosmeticOffset())
+		{
+			Component->ResetCosmeticOffset();
+		}
+
+		const float Radius = Character->GetSimpleCollisionRadius() * Component->CosmeticRadiusScalar;
+		Bodies.Add({ Component, Location, Radius, bSimulatedProxy });
+		MaxRadius = FMath::Max(MaxRadius, Radius);
+	}
+
+	if (Bodies.Num() == 0 || MaxRadius <= 0.f)
+	{
+		return;
+	}
+
+	// Cells are as large as the largest combined radius, so overlaps can only occur with neighbouring cells
+	const float CellSize = MaxRadius * 2.f;
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<8>>> Grid;
+	for (int32 i = 0; i < Bodies.Num(); i++)
+	{
+		const FIntPoint Cell(FMath::FloorToInt32(Bodies[i].Location.X / CellSize), FMath::FloorToInt32(Bodies[i].Location.Y / CellSize));
+		Grid.FindOrAdd(Cell).Add(i);
+	}
+
+	// Only a budgeted number of simulated proxies compute a new offset, the rest keep interpolating to their last one
+	const int32 Budget = FPushPawnCVars::PushPawnCosmeticMaxPawnsPerFrame;
+	const int32 NumToSolve = Budget > 0 ? FMath::Min(Budget, Bodies.Num()) : Bodies.Num();
+	SolveCursor = SolveCursor % Bodies.Num();
+	int32 NumSolved = 0;
+	for (int32 n = 0; n < NumToSolve; n++)
+	{
+		const int32 i = (SolveCursor + n) % Bodies.Num();
+		const FCosmeticBody& Body = Bodies[i];
+		if (!Body.bSimulatedProxy)
+		{
+			continue;
+		}
+
+		FVector Offset = FVector::ZeroVector;
+		const FIntPoint Cell(FMath::FloorToInt32(Body.Location.X / CellSize), FMath::FloorToInt32(Body.Location.Y / CellSize));
+		for (int32 Y = -1; Y <= 1; Y++)
+		{
+			for (int32 X = -1; X <= 1; X++)
+			{
+				const TArray<int32, TInlineAllocator<8>>* CellBodies = Grid.Find(Cell + FIntPoint(X, Y));
+				if (!CellBodies)
+				{
+					continue;
+				}
+
+				for (const int32 j : *CellBodies)
+				{
+					if (j == i)
+					{
+						continue;
+					}
+
+					const FCosmeticBody& Other = Bodies[j];
+					const FVector Delta = FVector(Body.Location.X - Other.Location.X, Body.Location.Y - Other.Location.Y, 0.f);
+					const float Distance = Delta.Size();
+					const float Penetration = Body.Radius + Other.Radius - Distance;
+					if (Penetration <= 0.f)
+					{
+						continue;
+					}
+
+					// Take half the penetration when the other pawn is offset too, otherwise all of it
+					const FVector Direction = Distance > UE_KINDA_SMALL_NUMBER ? Delta / Distance :
+						UPushStatics::GetTieBreakPushDirection(Body.Component->GetOwner(), Other.Component->GetOwner());
+					Offset += Direction * (Other.bSimulatedProxy ? Penetration * 0.5f : Penetration);
+				}
+			}
+		}
+
+		Body.Component->SetTargetOffset(Offset.GetClampedToMaxSize(Body.Component->MaxCosmeticOffset));
+		NumSolved++;
+	}
+	SolveCursor += NumToSolve;
+	INC_DWORD_STAT_BY(STAT_PushPawnCosmeticSolved, NumSolved);
+
+	// Interpolation is cheap compared to solving, every pawn in range keeps moving towards its latest offset
+	for (const FCosmeticBody& Body : Bodies)
+	{
+		if (Body.bSimulatedProxy && Body.Component->HasCosmeticOffset())
+		{
+			Body.Component->UpdateCosmeticOffset(DeltaTime);
+		}
+	}
+}
+
+TStatId UPushPawnCosmeticSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPushPawnCosmeticSubsystem, STATGROUP_Tickables);
+}
+
+bool UPushPawnCosmeticSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Dedicated servers have no simulated proxies to draw
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UPushPawnCosmeticSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,39 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnPhysicsForceBackend.h"
+
+#include "PushPawnPhysicsPushSubsystem.h"
+#include "PushTypes.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Pawn.h"
+
+UPrimitiveComponent* FPushPawnPhysicsForceBackend::GetSimulatingRootPrimitive(const APawn* Pawn)
+{
+	UPrimitiveComponent* RootPrimitive = Pawn ? Cast<UPrimitiveComponent>(Pawn->GetRootComponent()) : nullptr;
+	return RootPrimitive && RootPrimitive->IsSimulatingPhysics() ? RootPrimitive : nullptr;
+}
+
+bool FPushPawnPhysicsForceBackend::CanApplyPushForce(const APawn* Pushee) const
+{
+	return GetSimulatingRootPrimitive(Pushee) != nullptr;
+}
+
+void FPushPawnPhysicsForceBackend::ApplyPushForce(const APawn* Pushee, const FVector& PushForce, float Duration,
+	const FPushPawnActionParams& Params)
+{
+	UPrimitiveComponent* RootPrimitive = GetSimulatingRootPrimitive(Pushee);
+	if (!RootPrimitive || PushForce.IsNearlyZero())
+	{
+		return;
+	}
+
+	// Replicated physics bodies are simulated by the server, a client push would only be corrected away
+	if (!Pushee->HasAuthority() && Pushee->IsReplicatingMovement())
+	{
+		return;
+	}
+
+	const FVector VelocityChange = Params.bDistanceCheck2D ? FVector(PushForce.X, PushForce.Y, 0.f) : PushForce;
+	UPushPawnPhysicsPushSubsystem::QueuePhysicsPush(RootPrimitive, VelocityChange, Duration);
+}
@@ -0,0 +1,108 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnPhysicsPushSubsystem.h"
+
+#include "PushPawnStats.h"
+#include "Engine/World.h"
+#include "Components/PrimitiveComponent.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnPhysicsPushSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Pushes Queued"), STAT_PushPawnPhysicsPushesQueued, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Bodies Pushed"), STAT_PushPawnPhysicsBodiesPushed, STATGROUP_PushPawn);
+
+UPushPawnPhysicsPushSubsystem* UPushPawnPhysicsPushSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UPushPawnPhysicsPushSubsystem>() : nullptr;
+}
+
+void UPushPawnPhysicsPushSubsystem::Deinitialize()
+{
+	QueuedPhysicsPushes.Empty();
+	UnbindPhysScenePreTick();
+
+	Super::Deinitialize();
+}
+
+void UPushPawnPhysicsPushSubsystem::QueuePhysicsPush(UPrimitiveComponent* Primitive, const FVector& VelocityChange,
+	float Duration)
+{
+	UPushPawnPhysicsPushSubsystem* Subsystem = Primitive ? Get(Primitive->GetWorld()) : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	// Bind lazily, most worlds never push a physics body
+	if (!Subsystem->PhysScenePreTickHandle.IsValid())
+	{
+		FPhysScene_Chaos* PhysScene = Subsystem->GetWorld()->GetPhysicsScene();
+		if (!PhysScene)
+		{
+			return;
+		}
+		Subsystem->PhysScenePreTickHandle = PhysScene->OnPhysScenePreTick.AddUObject(Subsystem, &ThisClass::FlushPhysicsPushes);
+	}
+
+	Subsystem->QueuedPhysicsPushes.FindOrAdd(Primitive).Add({ VelocityChange, FMath::Max(0.f, Duration) });
+	INC_DWORD_STAT(STAT_PushPawnPhysicsPushesQueued);
+}
+
+void UPushPawnPhysicsPushSubsystem::FlushPhysicsPushes(FPhysScene_Chaos* PhysScene, float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawnPhysicsPushSubsystem::FlushPhysicsPushes);
+
+	// One call into the physics scene per body, regardless of how many pushes it received
+	for (auto It = QueuedPhysicsPushes.CreateIterator(); It; ++It)
+	{
+		UPrimitiveComponent* Primitive = It->Key.Get();
+		if (!Primitive || !Primitive->IsSimulatingPhysics())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Apply this step's share of each push, a push ends once its remaining time fits within the step
+		FVector VelocityChange = FVector::ZeroVector;
+		TArray<FPushPawnPhysicsPush, TInlineAllocator<2>>& Pushes = It->Value;
+		for (int32 i = Pushes.Num() - 1; i >= 0; i--)
+		{
+			FPushPawnPhysicsPush& Push = Pushes[i];
+			if (Push.RemainingTime <= DeltaTime)
+			{
+				VelocityChange += Push.VelocityChange;
+				Pushes.RemoveAtSwap(i);
+			}
+			else
+			{
+				const FVector StepVelocityChange = Push.VelocityChange * (DeltaTime / Push.RemainingTime);
+				VelocityChange += StepVelocityChange;
+				Push.VelocityChange -= StepVelocityChange;
+				Push.RemainingTime -= DeltaTime;
+			}
+		}
+
+		static constexpr bool bVelChange = true;
+		Primitive->AddImpulse(VelocityChange, NAME_None, bVelChange);
+		INC_DWORD_STAT(STAT_PushPawnPhysicsBodiesPushed);
+
+		if (Pushes.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UPushPawnPhysicsPushSubsystem::UnbindPhysScenePreTick()
+{
+	if (PhysScenePreTickHandle.IsValid())
+	{
+		if (FPhysScene_Chaos* PhysScene = GetWorld() ? GetWorld()->GetPhysicsScene() : nullptr)
+		{
+			PhysScene->OnPhysScenePreTick.Remove(PhysScenePreTickHandle);
+		}
+		PhysScenePreTickHandle.Reset();
+	}
+}
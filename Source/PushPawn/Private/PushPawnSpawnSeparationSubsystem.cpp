@@ -0,0 +1,159 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnSpawnSeparationSubsystem.h"
+
+#include "PushPawnStats.h"
+#include "PushStatics.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnSpawnSeparationSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawn Separation Pawns Moved"), STAT_PushPawnSpawnSeparationMoved, STATGROUP_PushPawn);
+
+UPushPawnSpawnSeparationSubsystem* UPushPawnSpawnSeparationSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UPushPawnSpawnSeparationSubsystem>() : nullptr;
+}
+
+int32 UPushPawnSpawnSeparationSubsystem::SeparatePawns(const TArray<APawn*>& Pawns, int32 MaxIterations)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPushPawnSpawnSeparationSubsystem::SeparatePawns);
+
+	struct FSeparationBody
+	{
+		APawn* Pawn;
+		FVector Location;
+		float Radius;
+	};
+
+	TArray<FSeparationBody, TInlineAllocator<64>> Bodies;
+	float MaxRadius = 0.f;
+	for (APawn* Pawn : Pawns)
+	{
+		if (IsValid(Pawn) && Pawn->HasAuthority())
+		{
+			const float Radius = Pawn->GetSimpleCollisionRadius();
+			Bodies.Add({ Pawn, Pawn->GetActorLocation(), Radius });
+			MaxRadius = FMath::Max(MaxRadius, Radius);
+		}
+	}
+
+	if (Bodies.Num() < 2 || MaxRadius <= 0.f)
+	{
+		return 0;
+	}
+
+	// Cells are as large as the largest combined radius, so overlaps can only occur with neighbouring cells
+	const float CellSize = MaxRadius * 2.f;
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<8>>> Grid;
+	TArray<bool, TInlineAllocator<64>> Moved;
+	Moved.SetNumZeroed(Bodies.Num());
+
+	for (int32 Iteration = 0; Iteration < MaxIterations; Iteration++)
+	{
+		Grid.Reset();
+		for (int32 i = 0; i < Bodies.Num(); i++)
+		{
+			const FIntPoint Cell(FMath::FloorToInt32(Bodies[i].Location.X / CellSize), FMath::FloorToInt32(Bodies[i].Location.Y / CellSize));
+			Grid.FindOrAdd(Cell).Add(i);
+		}
+
+		bool bResolvedAny = false;
+		for (int32 i = 0; i < Bodies.Num(); i++)
+		{
+			FSeparationBody& Body = Bodies[i];
+			const FIntPoint Cell(FMath::FloorToInt32(Body.Location.X / CellSize), FMath::FloorToInt32(Body.Location.Y / CellSize));
+			for (int32 Y = -1; Y <= 1; Y++)
+			{
+				for (int32 X = -1; X <= 1; X++)
+				{
+					const TArray<int32, TInlineAllocator<8>>* CellBodies = Grid.Find(Cell + FIntPoint(X, Y));
+					if (!CellBodies)
+					{
+						continue;
+					}
+
+					for (const int32 j : *CellBodies)
+					{
+						// Resolve each pair once
+						if (j <= i)
+						{
+							continue;
+						}
+
+						FSeparationBody& Other = Bodies[j];
+						const FVector Delta = FVector(Body.Location.X - Other.Location.X, Body.Location.Y - Other.Location.Y, 0.f);
+						const float Distance = Delta.Size();
+						const float Penetration = Body.Radius + Other.Radius - Distance;
+						if (Penetration <= 0.f)
+						{
+							continue;
+						}
+
+						// Move both halfway, using the same tie-break as pushes when they are on top of each other
+						const FVector Direction = Distance > UE_KINDA_SMALL_NUMBER ? Delta / Distance :
+							UPushStatics::GetTieBreakPushDirection(Body.Pawn, Other.Pawn);
+						Body.Location += Direction * (Penetration * 0.5f);
+						Other.Location -= Direction * (Penetration * 0.5f);
+						Moved[i] = true;
+						Moved[j] = true;
+						bResolvedAny = true;
+					}
+				}
+			}
+		}
+
+		if (!bResolvedAny)
+		{
+			break;
+		}
+	}
+
+	// Teleport checks against world geometry, so a pawn that can't be moved keeps its spawn location
+	int32 NumMoved = 0;
+	for (int32 i = 0; i < Bodies.Num(); i++)
+	{
+		if (Moved[i] && Bodies[i].Pawn->TeleportTo(Bodies[i].Location, Bodies[i].Pawn->GetActorRotation()))
+		{
+			NumMoved++;
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_PushPawnSpawnSeparationMoved, NumMoved);
+	return NumMoved;
+}
+
+void UPushPawnSpawnSeparationSubsystem::QueueSpawnSeparation(APawn* Pawn)
+{
+	UPushPawnSpawnSeparationSubsystem* Subsystem = Pawn && Pawn->HasAuthority() ? Get(Pawn->GetWorld()) : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	// Pawns spawned during the same frame are separated together
+	if (Subsystem->PendingSpawnSeparation.Num() == 0)
+	{
+		Subsystem->GetWorld()->GetTimerManager().SetTimerForNextTick(Subsystem, &ThisClass::FlushSpawnSeparation);
+	}
+	Subsystem->PendingSpawnSeparation.AddUnique(Pawn);
+}
+
+void UPushPawnSpawnSeparationSubsystem::FlushSpawnSeparation()
+{
+	TArray<APawn*> Pawns;
+	Pawns.Reserve(PendingSpawnSeparation.Num());
+	for (const TWeakObjectPtr<APawn>& Pawn : PendingSpawnSeparation)
+	{
+		if (Pawn.IsValid())
+		{
+			Pawns.Add(Pawn.Get());
+		}
+	}
+	PendingSpawnSeparation.Reset();
+
+	SeparatePawns(Pawns);
+}
@@ -0,0 +1,62 @@
+// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnSubsystem.h"
+
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnSubsystem)
+
+UPushPawnSubsystem::UPushPawnSubsystem()
+{
+	ResetPushGroups();
+}
+
+UPushPawnSubsystem* UPushPawnSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UPushPawnSubsystem>() : nullptr;
+}
+
+void UPushPawnSubsystem::SetPushGroupCanPush(int32 PusherGroup, int32 PusheeGroup, bool bCanPush)
+{
+	if (!ensureMsgf(IsValidPushGroup(PusherGroup) && IsValidPushGroup(PusheeGroup),
+		TEXT("PushPawn: Push groups must be in the range [0, %d)"), MaxPushGroups))
+	{
+		return;
+	}
+
+	if (bCanPush)
+	{
+		PushGroupMatrix[PusherGroup] |= (1u << PusheeGroup);
+	}
+	else
+	{
+		PushGroupMatrix[PusherGroup] &= ~(1u << PusheeGroup);
+	}
+}
+
+void UPushPawnSubsystem::SetPushGroupsCanPushEachOther(int32 GroupA, int32 GroupB, bool bCanPush)
+{
+	SetPushGroupCanPush(GroupA, GroupB, bCanPush);
+	SetPushGroupCanPush(GroupB, GroupA, bCanPush);
+}
+
+void UPushPawnSubsystem::ResetPushGroups()
+{
+	for (uint32& Row : PushGroupMatrix)
+	{
+		Row = MAX_uint32;
+	}
+}
+
+bool UPushPawnSubsystem::IsPushAllowedByGroup(const UWorld* World, int32 PusherGroup, int32 PusheeGroup)
+{
+	// Early out without a subsystem lookup when either side doesn't use push groups
+	if (!IsValidPushGroup(PusherGroup) || !IsValidPushGroup(PusheeGroup))
+	{
+		return true;
+	}
+
+	const UPushPawnSubsystem* Subsystem = Get(World);
+	return !Subsystem || Subsystem->CanPushGroupPush(PusherGroup, PusheeGroup);
+}
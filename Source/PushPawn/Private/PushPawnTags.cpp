@@ -6,4 +6,5 @@
 namespace FPushPawnTags
 {
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(PushPawn_PushAbility_Activate, "PushPawn.PushAbility.Activate", "Used as the payload event tag for activating a push ability.");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(PushPawn_NetSync_Pending, "PushPawn.NetSync.Pending", "Added to the payload instigator tags of a push triggered while a net sync is outstanding.");
 }
\ No newline at end of file
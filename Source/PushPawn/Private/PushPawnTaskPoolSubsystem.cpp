@@ -0,0 +1,85 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnTaskPoolSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "Abilities/Tasks/AbilityTask.h"
+#include "PushPawnStats.h"
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnTaskPoolSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Task Pool Hits"), STAT_PushPawnTaskPoolHits, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Task Pool Misses"), STAT_PushPawnTaskPoolMisses, STATGROUP_PushPawn);
+
+UPushPawnTaskPoolSubsystem* UPushPawnTaskPoolSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UPushPawnTaskPoolSubsystem>() : nullptr;
+}
+
+void UPushPawnTaskPoolSubsystem::Deinitialize()
+{
+	TaskPools.Empty();
+
+	Super::Deinitialize();
+}
+
+UAbilityTask* UPushPawnTaskPoolSubsystem::AcquirePooledTask(const UGameplayAbility* OwningAbility, const UClass* TaskClass)
+{
+	UAbilitySystemComponent* ASC = OwningAbility ? OwningAbility->GetAbilitySystemComponentFromActorInfo() : nullptr;
+	UPushPawnTaskPoolSubsystem* Subsystem = ASC ? Get(ASC->GetWorld()) : nullptr;
+	if (!Subsystem || !TaskClass)
+	{
+		return nullptr;
+	}
+
+	FPushPawnTaskPool* Pool = Subsystem->TaskPools.Find(ASC);
+	if (!Pool)
+	{
+		// Drop pools for ability system components that no longer exist before adding a new one
+		for (auto It = Subsystem->TaskPools.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		Pool = &Subsystem->TaskPools.Add(ASC);
+	}
+
+	// Re-use a free task of the same class if we have one
+	for (int32 i = Pool->FreeTasks.Num() - 1; i >= 0; i--)
+	{
+		UAbilityTask* Task = Pool->FreeTasks[i];
+		if (Task && Task->GetClass() == TaskClass)
+		{
+			Pool->FreeTasks.RemoveAtSwap(i);
+			INC_DWORD_STAT(STAT_PushPawnTaskPoolHits);
+			return Task;
+		}
+	}
+
+	INC_DWORD_STAT(STAT_PushPawnTaskPoolMisses);
+	return NewObject<UAbilityTask>(ASC, TaskClass);
+}
+
+void UPushPawnTaskPoolSubsystem::ReleasePooledTask(UAbilityTask* Task, UAbilitySystemComponent* ASC)
+{
+	UPushPawnTaskPoolSubsystem* Subsystem = ASC ? Get(ASC->GetWorld()) : nullptr;
+	if (!Subsystem || !Task)
+	{
+		return;
+	}
+
+	FPushPawnTaskPool& Pool = Subsystem->TaskPools.FindOrAdd(ASC);
+	if (!ensureMsgf(!Pool.FreeTasks.Contains(Task), TEXT("PushPawn: Task %s was released to the pool twice"), *Task->GetName()))
+	{
+		return;
+	}
+
+	if (Pool.FreeTasks.Num() < MaxPooledTasksPerASC)
+	{
+		Pool.FreeTasks.Add(Task);
+	}
+}
@@ -0,0 +1,85 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+
+#include "PushPawnValidationSubsystem.h"
+
+#include "PushPawnStats.h"
+#include "PushTypes.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PushPawnValidationSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Client Validation Escalations"), STAT_PushPawnValidationEscalations, STATGROUP_PushPawn);
+
+UPushPawnValidationSubsystem* UPushPawnValidationSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UPushPawnValidationSubsystem>() : nullptr;
+}
+
+FPushPawnClientValidation* UPushPawnValidationSubsystem::FindOrAddClientValidation(const APlayerController* Client)
+{
+	if (FPushPawnClientValidation* Validation = ClientValidation.Find(Client))
+	{
+		return Validation;
+	}
+
+	// Drop clients that have left before adding a new one
+	for (auto It = ClientValidation.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	return &ClientValidation.Add(Client);
+}
+
+bool UPushPawnValidationSubsystem::ShouldFullyValidatePush(const APlayerController* Client, const FPushPawnValidationParams& Params)
+{
+	UPushPawnValidationSubsystem* Subsystem = Client ? Get(Client->GetWorld()) : nullptr;
+	if (!Subsystem)
+	{
+		return true;
+	}
+
+	FPushPawnClientValidation& Validation = *Subsystem->FindOrAddClientValidation(Client);
+	if (Validation.EscalatedUntil >= 0.0 && Subsystem->GetWorld()->GetTimeSeconds() < Validation.EscalatedUntil)
+	{
+		return true;
+	}
+
+	// Evenly spaced samples rather than random, so every client is validated at exactly the same rate
+	Validation.FullValidationAccumulator += Params.FullValidationFraction;
+	if (Validation.FullValidationAccumulator >= 1.f)
+	{
+		Validation.FullValidationAccumulator -= 1.f;
+		return true;
+	}
+	return false;
+}
+
+void UPushPawnValidationSubsystem::ReportInvalidPush(const APlayerController* Client, const FPushPawnValidationParams& Params)
+{
+	UPushPawnValidationSubsystem* Subsystem = Client ? Get(Client->GetWorld()) : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	FPushPawnClientValidation& Validation = *Subsystem->FindOrAddClientValidation(Client);
+	const double Now = Subsystem->GetWorld()->GetTimeSeconds();
+
+	// Leak ErrorsToEscalate over the error window, so only a burst of errors escalates
+	const float LeakRate = Params.ErrorsToEscalate / FMath::Max(Params.ErrorWindow, UE_KINDA_SMALL_NUMBER);
+	Validation.ErrorScore = FMath::Max(0.f, Validation.ErrorScore - static_cast<float>(Now - Validation.LastErrorTime) * LeakRate);
+	Validation.ErrorScore += 1.f;
+	Validation.LastErrorTime = Now;
+
+	if (Validation.ErrorScore >= Params.ErrorsToEscalate)
+	{
+		Validation.ErrorScore = 0.f;
+		Validation.EscalatedUntil = Now + Params.EscalationDuration;
+		INC_DWORD_STAT(STAT_PushPawnValidationEscalations);
+	}
+}
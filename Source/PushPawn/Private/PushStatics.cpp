@@ -11,10 +11,17 @@
 #include "Components/PusherComponent.h"
 #include "Components/SphereComponent.h"
 #include "IPush.h"
+#include "PushPawnForceBackend.h"
 #include "PushQuery.h"
+#include "Tasks/AbilityTask_PushPawnForce.h"
 
 #include "Engine/OverlapResult.h"
+#include "Engine/NetDriver.h"
+#include "Engine/PackageMapClient.h"
+#include "AbilitySystemGlobals.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "Curves/CurveFloat.h"
+#include "Features/IModularFeatures.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PushStatics)
 
@@ -83,6 +90,25 @@ void UPushStatics::GetPushDataFromEventData(const FGameplayEventData& EventData,
 	// Get the target data from the event data
 	const FGameplayAbilityTargetData* RawData = EventData.TargetData.Get(0);
 	check(RawData);
+
+	// Combined target data, everything is contained in a single struct
+	if (RawData->GetScriptStruct() == FPushPawnPushTargetData::StaticStruct())
+	{
+		const FPushPawnPushTargetData& PushTargetData = static_cast<const FPushPawnPushTargetData&>(*RawData);
+		PushDirection = bForce2D ? PushTargetData.Direction.GetSafeNormal2D() : PushTargetData.Direction.GetSafeNormal();
+
+		// Distance is sent as a fraction of the combined radius, convert it back
+		const AActor* Pushee = EventData.Instigator.Get();
+		const AActor* Pusher = EventData.Target.Get();
+		const float CombinedRadius = (Pushee ? Pushee->GetSimpleCollisionRadius() : 0.f) +
+			(Pusher ? Pusher->GetSimpleCollisionRadius() : 0.f);
+		DistanceBetween = PushTargetData.NormalizedDistance * CombinedRadius;
+		StrengthScalar = PushTargetData.StrengthScalar;
+		bOverrideStrength = PushTargetData.bOverrideStrength;
+		return;
+	}
+
+	// Legacy format, direction and distance followed by optional strength
 	const FPushPawnAbilityTargetData& PushTargetData = static_cast<const FPushPawnAbilityTargetData&>(*RawData);
 
 	// Normalize the direction
@@ -99,7 +125,8 @@ void UPushStatics::GetPushDataFromEventData(const FGameplayEventData& EventData,
 	DistanceBetween = PushTargetData.Distance;
 
 	// Get the strength target data from the event data if available
-	if (const FGameplayAbilityTargetData* RawStrengthData = EventData.TargetData.Get(1))
+	const FGameplayAbilityTargetData* RawStrengthData = EventData.TargetData.Get(1);
+	if (RawStrengthData && RawStrengthData->GetScriptStruct() == FPushPawnStrengthTargetData::StaticStruct())
 	{
 		const FPushPawnStrengthTargetData& PushStrengthTargetData = static_cast<const FPushPawnStrengthTargetData&>(*RawStrengthData);
 		
@@ -116,6 +143,177 @@ void UPushStatics::GetPushDataFromEventData(const FGameplayEventData& EventData,
 	}
 }
 
+int32 UPushStatics::GetNumPushesInEventData(const FGameplayEventData& EventData)
+{
+	// Only the combined target data can be batched, anything else is a single push
+	int32 NumPushes = 0;
+	for (const TSharedPtr<FGameplayAbilityTargetData>& TargetData : EventData.TargetData.Data)
+	{
+		if (TargetData.IsValid() && TargetData->GetScriptStruct() == FPushPawnPushTargetData::StaticStruct())
+		{
+			NumPushes++;
+		}
+	}
+	return FMath::Max(1, NumPushes);
+}
+
+bool UPushStatics::GetBatchedPushDataFromEventData(const FGameplayEventData& EventData, int32 PushIndex, bool bForce2D,
+	FVector& PushDirection, float& NormalizedDistance, float& StrengthScalar, bool& bOverrideStrength)
+{
+	int32 NumPushes = 0;
+	for (const TSharedPtr<FGameplayAbilityTargetData>& TargetData : EventData.TargetData.Data)
+	{
+		if (TargetData.IsValid() && TargetData->GetScriptStruct() == FPushPawnPushTargetData::StaticStruct())
+		{
+			if (NumPushes++ == PushIndex)
+			{
+				const FPushPawnPushTargetData& PushTargetData = static_cast<const FPushPawnPushTargetData&>(*TargetData);
+				PushDirection = bForce2D ? PushTargetData.Direction.GetSafeNormal2D() : PushTargetData.Direction.GetSafeNormal();
+				NormalizedDistance = PushTargetData.NormalizedDistance;
+				StrengthScalar = PushTargetData.StrengthScalar;
+				bOverrideStrength = PushTargetData.bOverrideStrength;
+				return true;
+			}
+		}
+	}
+
+	PushDirection = FVector::ZeroVector;
+	NormalizedDistance = 0.f;
+	StrengthScalar = 1.f;
+	bOverrideStrength = false;
+	return false;
+}
+
+FVector UPushStatics::AccumulateBatchedPushForce(const APawn* Pushee, const FGameplayEventData& EventData,
+	int32 FirstPushIndex, const FPushPawnActionParams& Params, const FVector& InitialForce)
+{
+	// Single pass over the target data, the number of entries is controlled by the client
+	FVector PushForce = InitialForce;
+	float MaxStrength = InitialForce.Size();
+	int32 PushIndex = 0;
+	for (const TSharedPtr<FGameplayAbilityTargetData>& TargetData : EventData.TargetData.Data)
+	{
+		if (!TargetData.IsValid() || TargetData->GetScriptStruct() != FPushPawnPushTargetData::StaticStruct())
+		{
+			continue;
+		}
+		if (PushIndex++ < FirstPushIndex)
+		{
+			continue;
+		}
+
+		const FPushPawnPushTargetData& PushTargetData = static_cast<const FPushPawnPushTargetData&>(*TargetData);
+		const FVector Direction = Params.bDistanceCheck2D ?
+			PushTargetData.Direction.GetSafeNormal2D() : PushTargetData.Direction.GetSafeNormal();
+		const float Strength = CalculatePushStrength(Pushee, PushTargetData.bOverrideStrength,
+			PushTargetData.StrengthScalar, PushTargetData.NormalizedDistance, Params);
+
+		PushForce += Direction * Strength;
+		MaxStrength = FMath::Max(MaxStrength, FMath::Abs(Strength));
+	}
+
+	// A batch can't add up to more than a multiple of its strongest push
+	return PushForce.GetClampedToMaxSize(MaxStrength * FMath::Max(1.f, Params.MaxBatchedForceScalar));
+}
+
+IPushPawnMovementAccumulator* UPushStatics::GetPushMovementAccumulator(const APawn* Pawn, EPushPawnForceBackend Backend)
+{
+	if (!Pawn || Backend == EPushPawnForceBackend::RootMotionSource)
+	{
+		return nullptr;
+	}
+	return Cast<IPushPawnMovementAccumulator>(Pawn->GetMovementComponent());
+}
+
+bool UPushStatics::AccumulatePushForce(const APawn* Pushee, const FVector& PushForce, EPushPawnForceBackend Backend)
+{
+	IPushPawnMovementAccumulator* Accumulator = GetPushMovementAccumulator(Pushee, Backend);
+	if (!Accumulator)
+	{
+		return false;
+	}
+
+	// Remotely controlled pawns receive the push with the client's moves
+	if (Pushee->IsLocallyControlled() || !Accumulator->ReceivesPushesFromClientMoves())
+	{
+		Accumulator->AddPushVelocity(PushForce);
+	}
+	else
+	{
+		// The client's moves may only carry pushes the server activated itself
+		Accumulator->AuthorizePushVelocity(PushForce);
+	}
+	return true;
+}
+
+IPushPawnForceBackend* UPushStatics::FindPushForceBackend(const APawn* Pawn, EPushPawnForceBackend Backend)
+{
+	if (!Pawn || Backend != EPushPawnForceBackend::Auto)
+	{
+		return nullptr;
+	}
+
+	// Index the implementations directly, GetModularFeatureImplementations() would allocate an array for every push
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+	const FName FeatureName = IPushPawnForceBackend::GetModularFeatureName();
+	const int32 NumBackends = ModularFeatures.GetModularFeatureImplementationCount(FeatureName);
+	for (int32 i = 0; i < NumBackends; i++)
+	{
+		IPushPawnForceBackend* ForceBackend = static_cast<IPushPawnForceBackend*>(
+			ModularFeatures.GetModularFeatureImplementation(FeatureName, i));
+		if (ForceBackend && ForceBackend->CanApplyPushForce(Pawn))
+		{
+			return ForceBackend;
+		}
+	}
+	return nullptr;
+}
+
+bool UPushStatics::ApplyPushForceDirect(const APawn* Pushee, const FVector& PushForce, const FPushPawnActionParams& Params)
+{
+	if (!IsValid(Pushee))
+	{
+		return false;
+	}
+
+	float Duration = Params.Duration;
+	UAbilitySystemGlobals::NonShipping_ApplyGlobalAbilityScaler_Duration(Duration);
+
+	// Let the backend apply the push to a non-character movement component, e.g. a UMoverComponent
+	UCharacterMovementComponent* MovementComponent = Cast<UCharacterMovementComponent>(Pushee->GetMovementComponent());
+	if (!MovementComponent)
+	{
+		if (IPushPawnForceBackend* ForceBackend = FindPushForceBackend(Pushee, Params.ForceBackend))
+		{
+			ForceBackend->ApplyPushForce(Pushee, PushForce, Duration, Params);
+			return true;
+		}
+		return false;
+	}
+
+	if (MovementComponent->MovementMode == MOVE_None)
+	{
+		return false;
+	}
+
+	// Accumulate the push on the movement component instead of using a root motion source
+	if (AccumulatePushForce(Pushee, PushForce, Params.ForceBackend))
+	{
+		return true;
+	}
+
+	// Nothing owns the source's removal, so always merge into an active push instead of stacking additive sources
+	static constexpr bool bIsAdditive = true;
+	static constexpr bool bEnableGravity = true;
+	float MergedRemainingTime;
+	if (UAbilityTask_PushPawnForce::MergePushForce(MovementComponent, PushForce, Duration, bIsAdditive, bEnableGravity,
+		nullptr, MergedRemainingTime) == (uint16)ERootMotionSourceID::Invalid)
+	{
+		UAbilityTask_PushPawnForce::ApplyPushForce(MovementComponent, PushForce, Duration, bIsAdditive, bEnableGravity);
+	}
+	return true;
+}
+
 bool UPushStatics::GetDefaultCapsuleRootComponent(const AActor* Actor, float& CapsuleRadius, float& CapsuleHalfHeight)
 {
 	CapsuleRadius = 0.f;
@@ -169,6 +367,34 @@ float UPushStatics::GetPusheeGroundSpeed(const IPusheeInstigator* Pushee)
 	return GetPusheeGroundVelocity(Pushee).Size();
 }
 
+float UPushStatics::GetPusheeGroundSpeed(const FPusheeScanSnapshot& Snapshot)
+{
+	// Factor incline into the velocity when on the ground
+	const FVector& Velocity = Snapshot.Velocity;
+	return Snapshot.bIsMovingOnGround ? Velocity.Size() : Velocity.Size2D();
+}
+
+FPusheeScanSnapshot UPushStatics::GetPusheeScanSnapshot(const IPusheeInstigator* Pushee)
+{
+	FPusheeScanSnapshot Snapshot;
+	if (!Pushee)
+	{
+		return Snapshot;
+	}
+
+	// Batched retrieval is preferred, otherwise fall back to the individual getters
+	if (!Pushee->GetPusheeScanSnapshot(Snapshot))
+	{
+		Snapshot.Acceleration = Pushee->GetPusheeAcceleration();
+		Snapshot.Velocity = Pushee->GetPusheeVelocity();
+		Snapshot.bIsMovingOnGround = Pushee->IsPusheeMovingOnGround();
+	}
+
+	// Acceleration is always normalized with Mover's MovementIntent in mind
+	Snapshot.Acceleration = Snapshot.Acceleration.GetSafeNormal();
+	return Snapshot;
+}
+
 float UPushStatics::GetNormalizedPushDistance(const AActor* Pushee, const AActor* Pusher, float DistanceBetween)
 {
 	const float CombinedRadius = Pushee->GetSimpleCollisionRadius() + Pusher->GetSimpleCollisionRadius();
@@ -177,6 +403,13 @@ float UPushStatics::GetNormalizedPushDistance(const AActor* Pushee, const AActor
 }
 
 float UPushStatics::GetPushStrength(const APawn* Pushee, float Distance, const FPushPawnActionParams& Params)
+{
+	// Only query the speed of the pushee if the curve will use it
+	const float PusheeSpeed = Params.VelocityToStrengthCurve ? GetPawnGroundSpeed(Pushee) : 0.f;
+	return GetPushStrengthForSpeed(PusheeSpeed, Distance, Params);
+}
+
+float UPushStatics::GetPushStrengthForSpeed(float PusheeSpeed, float Distance, const FPushPawnActionParams& Params)
 {
 	// Get the strength from the curve and apply the scalar
 	float Strength = Params.StrengthScalar;
@@ -195,9 +428,6 @@ float UPushStatics::GetPushStrength(const APawn* Pushee, float Distance, const F
 
 		if (bEvaluateVelocityToStrengthCurve)
 		{
-			// Get the speed of the pushee
-			const float PusheeSpeed = GetPawnGroundSpeed(Pushee);
-
 			// Get the strength from the curve and apply the scalar
 			Strength *= Params.VelocityToStrengthCurve->GetFloatValue(PusheeSpeed);	
 		}
@@ -281,6 +511,45 @@ float UPushStatics::GetPushStrengthSimple(const APawn* Pushee, const UCurveFloat
 	return Strength;
 }
 
+uint32 UPushStatics::GetStablePushID(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return 0;
+	}
+
+	const UNetDriver* NetDriver = Actor->GetNetDriver();
+	if (NetDriver && NetDriver->GuidCache.IsValid())
+	{
+		const FNetworkGUID NetGUID = NetDriver->GuidCache->GetNetGUID(Actor);
+		if (NetGUID.IsValid())
+		{
+			return GetTypeHash(NetGUID);
+		}
+	}
+
+	// The object's unique ID is process-local, the actor's name is the same on both sides for actors loaded with the
+	// level. The world's package name is left out, PIE prefixes it differently for each instance
+	TStringBuilder<NAME_SIZE> ActorName;
+	Actor->GetFName().AppendString(ActorName);
+	return FCrc::StrCrc32(ActorName.ToString());
+}
+
+FVector UPushStatics::GetTieBreakPushDirection(const AActor* Pushee, const AActor* Pusher)
+{
+	const uint32 PusheeID = GetStablePushID(Pushee);
+	const uint32 PusherID = GetStablePushID(Pusher);
+
+	// Order the pair so both pawns compute the same hash, then push each of them to opposite sides
+	const uint32 PairHash = HashCombineFast(FMath::Min(PusheeID, PusherID), FMath::Max(PusheeID, PusherID));
+	float Angle = (PairHash & 0xFFFF) * (UE_TWO_PI / 65536.f);
+	if (PusheeID > PusherID)
+	{
+		Angle += UE_PI;
+	}
+	return { FMath::Cos(Angle), FMath::Sin(Angle), 0.f };
+}
+
 float UPushStatics::CalculatePushDirection(const FVector& Direction, const FRotator& BaseRotation)
 {
 	if (!Direction.IsNearlyZero())
@@ -10,7 +10,10 @@
 
 FPushPawnScanParams::FPushPawnScanParams()
 	: bDirectionIs2D(true)
+	, QueryType(EPushPawnScanQueryType::Channel)
 	, TraceChannel(ECC_Visibility)
+	, ObjectTypes({ ECC_Pawn })
+	, bDynamicObjectsOnly(false)
     , ScanRangeScalar(0.8f)
     , ScanRangeAccelScalar(1.1f)
     , PusheeRadiusScalar(0.8f)
@@ -21,6 +24,41 @@ FPushPawnScanParams::FPushPawnScanParams()
 	, StrengthOverrideHandling(EPushPawnOverrideHandling::Min)
 {}
 
+bool FPushPawnIgnoreList::Add(AActor* Actor)
+{
+	if (!Actor || Actors.Contains(Actor))
+	{
+		return false;
+	}
+	Actors.Add(Actor);
+	Revision++;
+	return true;
+}
+
+bool FPushPawnIgnoreList::Remove(const AActor* Actor)
+{
+	const int32 NumRemoved = Actors.RemoveAllSwap([Actor](const TWeakObjectPtr<AActor>& Other)
+	{
+		return !Other.IsValid() || Other.Get() == Actor;
+	});
+
+	if (NumRemoved > 0)
+	{
+		Revision++;
+		return true;
+	}
+	return false;
+}
+
+void FPushPawnIgnoreList::Reset()
+{
+	if (Actors.Num() > 0)
+	{
+		Actors.Reset();
+		Revision++;
+	}
+}
+
 FCollisionShape FPushPawnCollisionShapeHelper::ToCollisionShape() const
 {
 	switch (CollisionType)
@@ -7,6 +7,7 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "AbilitySystemLog.h"
+#include "PushPawnStats.h"
 
 #include "TimerManager.h"
 #include "Engine/World.h"
@@ -15,6 +16,8 @@
 
 static const FName PushPawnForceName = TEXT("PushPawnForce");
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Push Forces Merged"), STAT_PushPawnForcesMerged, STATGROUP_PushPawn);
+
 UAbilityTask_PushPawnForce::UAbilityTask_PushPawnForce(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -28,6 +31,7 @@ UAbilityTask_PushPawnForce::UAbilityTask_PushPawnForce(const FObjectInitializer&
 	StrengthOverTime = nullptr;
 	bIsAdditive = true;
 	bEnableGravity = false;
+	bMergeWithExisting = false;
 
 	RootMotionSourceID = (uint16)ERootMotionSourceID::Invalid;
 	bIsFinished = false;
@@ -35,11 +39,11 @@ UAbilityTask_PushPawnForce::UAbilityTask_PushPawnForce(const FObjectInitializer&
 
 UAbilityTask_PushPawnForce* UAbilityTask_PushPawnForce::ApplyPushPawnForce(UGameplayAbility* OwningAbility,
 	const FVector& WorldDirection, float Strength, float Duration, bool bIsAdditive, bool bEnableGravity,
-	UCurveFloat* StrengthOverTime)
+	UCurveFloat* StrengthOverTime, bool bMergeWithExisting)
 {
 	UAbilitySystemGlobals::NonShipping_ApplyGlobalAbilityScaler_Duration(Duration);
 
-	UAbilityTask_PushPawnForce* MyTask = NewAbilityTask<UAbilityTask_PushPawnForce>(OwningAbility, PushPawnForceName);
+	UAbilityTask_PushPawnForce* MyTask = NewPooledAbilityTask<UAbilityTask_PushPawnForce>(OwningAbility, PushPawnForceName);
 
 	MyTask->WorldDirection = WorldDirection.GetSafeNormal();
 	MyTask->Strength = Strength;
@@ -47,6 +51,7 @@ UAbilityTask_PushPawnForce* UAbilityTask_PushPawnForce::ApplyPushPawnForce(UGame
 	MyTask->bIsAdditive = bIsAdditive;
 	MyTask->bEnableGravity = bEnableGravity;
 	MyTask->StrengthOverTime = StrengthOverTime;
+	MyTask->bMergeWithExisting = bMergeWithExisting;
 
 	// Don't forget to call SharedInitAndApply() after creating this task - it is not performed automatically,
 	//	so you can bind to the OnTaskEnded delegate before calling Activate() to ensure you don't miss the event
@@ -61,11 +66,12 @@ UAbilityTask_PushPawnForce* UAbilityTask_PushPawnForce::K2_ApplyPushPawnForce(
 	float Duration,
 	bool bIsAdditive,
 	bool bEnableGravity,
-	UCurveFloat* StrengthOverTime)
+	UCurveFloat* StrengthOverTime,
+	bool bMergeWithExisting)
 {
 	UAbilitySystemGlobals::NonShipping_ApplyGlobalAbilityScaler_Duration(Duration);
 
-	UAbilityTask_PushPawnForce* MyTask = NewAbilityTask<UAbilityTask_PushPawnForce>(OwningAbility, PushPawnForceName);
+	UAbilityTask_PushPawnForce* MyTask = NewPooledAbilityTask<UAbilityTask_PushPawnForce>(OwningAbility, PushPawnForceName);
 
 	MyTask->WorldDirection = WorldDirection.GetSafeNormal();
 	MyTask->Strength = Strength;
@@ -73,6 +79,7 @@ UAbilityTask_PushPawnForce* UAbilityTask_PushPawnForce::K2_ApplyPushPawnForce(
 	MyTask->bIsAdditive = bIsAdditive;
 	MyTask->bEnableGravity = bEnableGravity;
 	MyTask->StrengthOverTime = StrengthOverTime;
+	MyTask->bMergeWithExisting = bMergeWithExisting;
 	MyTask->SharedInitAndApply();
 
 	return MyTask;
@@ -87,26 +94,23 @@ void UAbilityTask_PushPawnForce::InitSimulatedTask(UGameplayTasksComponent& InGa
 
 void UAbilityTask_PushPawnForce::SharedInitAndApply()
 {
+	bIsFinished = false;
+
 	const UAbilitySystemComponent* ASC = AbilitySystemComponent.Get();
 	if (ASC && ASC->AbilityActorInfo->MovementComponent.IsValid())
 	{
 		MovementComponent = Cast<UCharacterMovementComponent>(ASC->AbilityActorInfo->MovementComponent.Get());
 
+		// Fold into the existing push force instead of stacking another root motion source
+		if (MovementComponent && bMergeWithExisting && MergeWithExistingForce())
+		{
+			return;
+		}
+
 		if (MovementComponent)
 		{
-			const TSharedPtr<FRootMotionSource_ConstantForce> ConstantForce = MakeShared<FRootMotionSource_ConstantForce>();
-			ConstantForce->InstanceName = TEXT("PushPawnForce");
-			ConstantForce->AccumulateMode = bIsAdditive ? ERootMotionAccumulateMode::Additive : ERootMotionAccumulateMode::Override;
-			ConstantForce->Priority = 2;  // Low priority for pushing
-			ConstantForce->Force = WorldDirection * Strength;
-			ConstantForce->Duration = Duration;
-			ConstantForce->StrengthOverTime = StrengthOverTime;
-			ConstantForce->FinishVelocityParams.Mode = ERootMotionFinishVelocityMode::MaintainLastRootMotionVelocity;
-			if (bEnableGravity)
-			{
-				ConstantForce->Settings.SetFlag(ERootMotionSourceSettingsFlags::IgnoreZAccumulate);
-			}
-			RootMotionSourceID = MovementComponent->ApplyRootMotionSource(ConstantForce);
+			RootMotionSourceID = ApplyPushForce(MovementComponent, WorldDirection * Strength, Duration, bIsAdditive,
+				bEnableGravity, StrengthOverTime);
 			if (RootMotionSourceID != (uint16)ERootMotionSourceID::Invalid)
 			{
 				const FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(this, &ThisClass::EndTask);
@@ -128,6 +132,136 @@ void UAbilityTask_PushPawnForce::SharedInitAndApply()
 	}
 }
 
+bool UAbilityTask_PushPawnForce::UpdatePushForce(const FVector& InWorldDirection, float InStrength, float InDuration)
+{
+	if (bIsFinished || !MovementComponent)
+	{
+		return false;
+	}
+
+	const TSharedPtr<FRootMotionSource> RMS = MovementComponent->GetRootMotionSourceByID(RootMotionSourceID);
+	if (!RMS.IsValid() || RMS->Status.HasFlag(ERootMotionSourceStatusFlags::Finished) ||
+		RMS->GetScriptStruct() != FRootMotionSource_ConstantForce::StaticStruct())
+	{
+		return false;
+	}
+
+	UAbilitySystemGlobals::NonShipping_ApplyGlobalAbilityScaler_Duration(InDuration);
+
+	// Replace the source instead of editing its force in place. Saved moves only restore the state of the live
+	// sources when replaying, so an in place edit would replay earlier moves with the new force, and the server would
+	// apply it at a different point in the move stream. A new source is captured by the following moves as usual
+	const uint16 NewRootMotionSourceID = ApplyPushForce(MovementComponent, InWorldDirection.GetSafeNormal() * InStrength,
+		InDuration, bIsAdditive, bEnableGravity, StrengthOverTime);
+	if (NewRootMotionSourceID == (uint16)ERootMotionSourceID::Invalid)
+	{
+		return false;
+	}
+
+	MovementComponent->RemoveRootMotionSourceByID(RootMotionSourceID);
+	RootMotionSourceID = NewRootMotionSourceID;
+
+	WorldDirection = InWorldDirection.GetSafeNormal();
+	Strength = InStrength;
+	Duration = InDuration;
+
+	// Restart the timer to finish when the extended duration lapses
+	const FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(this, &ThisClass::EndTask);
+	GetWorld()->GetTimerManager().SetTimer(FinishTimerHandle, TimerDelegate, InDuration, false);
+
+	return true;
+}
+
+uint16 UAbilityTask_PushPawnForce::ApplyPushForce(UCharacterMovementComponent* InMovementComponent, const FVector& Force,
+	float InDuration, bool bInIsAdditive, bool bInEnableGravity, UCurveFloat* InStrengthOverTime)
+{
+	if (!InMovementComponent)
+	{
+		return (uint16)ERootMotionSourceID::Invalid;
+	}
+
+	const TSharedPtr<FRootMotionSource_ConstantForce> ConstantForce = MakeShared<FRootMotionSource_ConstantForce>();
+	ConstantForce->InstanceName = PushPawnForceName;
+	ConstantForce->AccumulateMode = bInIsAdditive ? ERootMotionAccumulateMode::Additive : ERootMotionAccumulateMode::Override;
+	ConstantForce->Priority = 2;  // Low priority for pushing
+	ConstantForce->Force = Force;
+	ConstantForce->Duration = InDuration;
+	ConstantForce->StrengthOverTime = InStrengthOverTime;
+	ConstantForce->FinishVelocityParams.Mode = ERootMotionFinishVelocityMode::MaintainLastRootMotionVelocity;
+	if (bInEnableGravity)
+	{
+		ConstantForce->Settings.SetFlag(ERootMotionSourceSettingsFlags::IgnoreZAccumulate);
+	}
+	return InMovementComponent->ApplyRootMotionSource(ConstantForce);
+}
+
+uint16 UAbilityTask_PushPawnForce::MergePushForce(UCharacterMovementComponent* InMovementComponent, const FVector& Force,
+	float InDuration, bool bInIsAdditive, bool bInEnableGravity, UCurveFloat* InStrengthOverTime, float& OutRemainingTime)
+{
+	OutRemainingTime = 0.f;
+
+	const TSharedPtr<FRootMotionSource> RMS = InMovementComponent ? InMovementComponent->GetRootMotionSource(PushPawnForceName) : nullptr;
+	if (!RMS.IsValid() || RMS->Status.HasFlag(ERootMotionSourceStatusFlags::Finished) ||
+		RMS->GetScriptStruct() != FRootMotionSource_ConstantForce::StaticStruct())
+	{
+		return (uint16)ERootMotionSourceID::Invalid;
+	}
+
+	// Only merge with sources that accumulate the same way
+	const FRootMotionSource_ConstantForce* ConstantForce = static_cast<const FRootMotionSource_ConstantForce*>(RMS.Get());
+	const ERootMotionAccumulateMode AccumulateMode = bInIsAdditive ? ERootMotionAccumulateMode::Additive : ERootMotionAccumulateMode::Override;
+	if (ConstantForce->AccumulateMode != AccumulateMode || ConstantForce->StrengthOverTime != InStrengthOverTime)
+	{
+		return (uint16)ERootMotionSourceID::Invalid;
+	}
+
+	// Sources are never edited after they're applied, so the force and duration are what the source was created with
+	// and its time is movement state that is saved and restored with each move, nothing here depends on when or how
+	// often the merge happened to be computed locally
+	// Existing force is scaled by its remaining fraction so that merging doesn't compound strength indefinitely
+	const float RemainingTime = FMath::Max(0.f, ConstantForce->Duration - ConstantForce->GetTime());
+	const float RemainingFraction = ConstantForce->Duration > 0.f ? RemainingTime / ConstantForce->Duration : 0.f;
+	const FVector MergedForce = ConstantForce->Force * RemainingFraction + Force;
+
+	// Extend to whichever lasts longer
+	OutRemainingTime = FMath::Max(RemainingTime, InDuration);
+
+	// Replace the source, the new LocalID identifies the last writer which owns its removal
+	const uint16 MergedRootMotionSourceID = ApplyPushForce(InMovementComponent, MergedForce, OutRemainingTime,
+		bInIsAdditive, bInEnableGravity, InStrengthOverTime);
+	if (MergedRootMotionSourceID != (uint16)ERootMotionSourceID::Invalid)
+	{
+		InMovementComponent->RemoveRootMotionSourceByID(ConstantForce->LocalID);
+		INC_DWORD_STAT(STAT_PushPawnForcesMerged);
+	}
+	return MergedRootMotionSourceID;
+}
+
+bool UAbilityTask_PushPawnForce::MergeWithExistingForce()
+{
+	float MergedRemainingTime;
+	const uint16 MergedRootMotionSourceID = MergePushForce(MovementComponent, WorldDirection * Strength, Duration,
+		bIsAdditive, bEnableGravity, StrengthOverTime, MergedRemainingTime);
+	if (MergedRootMotionSourceID == (uint16)ERootMotionSourceID::Invalid)
+	{
+		return false;
+	}
+
+	// We're now the last writer, and therefore own removal of the source
+	RootMotionSourceID = MergedRootMotionSourceID;
+
+	const FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(this, &ThisClass::EndTask);
+	GetWorld()->GetTimerManager().SetTimer(FinishTimerHandle, TimerDelegate, MergedRemainingTime, false);
+
+	return true;
+}
+
+bool UAbilityTask_PushPawnForce::OwnsRootMotionSource() const
+{
+	const TSharedPtr<FRootMotionSource> RMS = MovementComponent ? MovementComponent->GetRootMotionSourceByID(RootMotionSourceID) : nullptr;
+	return RMS.IsValid() && RMS->InstanceName == PushPawnForceName;
+}
+
 bool UAbilityTask_PushPawnForce::HasTimedOut() const
 {
 	const TSharedPtr<FRootMotionSource> RMS = (MovementComponent ? MovementComponent->GetRootMotionSourceByID(RootMotionSourceID) : nullptr);
@@ -143,16 +277,46 @@ void UAbilityTask_PushPawnForce::OnDestroy(bool bInOwnerFinished)
 {
 	if (MovementComponent)
 	{
-		MovementComponent->RemoveRootMotionSourceByID(RootMotionSourceID);
+		// Another push may have merged into and replaced our source since, in which case it owns removal
+		if (OwnsRootMotionSource())
+		{
+			MovementComponent->RemoveRootMotionSourceByID(RootMotionSourceID);
+		}
 	}
 
-	// Used to end an ability
-	bIsFinished = true;
-	OnFinish.Broadcast();
+	// Used to end an ability, which destroys this task again from within the broadcast so only broadcast once
+	if (!bIsFinished)
+	{
+		bIsFinished = true;
+		OnFinish.Broadcast();
+	}
 	
 	Super::OnDestroy(bInOwnerFinished);
 }
 
+void UAbilityTask_PushPawnForce::ResetPooledTask()
+{
+	// Our timer must not end the task once it has been re-used
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(FinishTimerHandle);
+	}
+	FinishTimerHandle.Invalidate();
+	OnFinish.Clear();
+
+	Super::ResetPooledTask();
+
+	MovementComponent = nullptr;
+	WorldDirection = FVector::ZeroVector;
+	Strength = 0.f;
+	Duration = 0.f;
+	StrengthOverTime = nullptr;
+	bIsAdditive = true;
+	bEnableGravity = false;
+	bMergeWithExisting = false;
+	RootMotionSourceID = (uint16)ERootMotionSourceID::Invalid;
+}
+
 void UAbilityTask_PushPawnForce::PreDestroyFromReplication()
 {
 	EndTask();
@@ -0,0 +1,58 @@
+// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Tasks/AbilityTask_PushPawnPooled.h"
+
+#include "GameplayTasksComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AbilityTask_PushPawnPooled)
+
+void UAbilityTask_PushPawnPooled::InitPooledTask(UGameplayAbility& ThisAbility, FName InInstanceName)
+{
+	bPooled = true;
+	bReleasedToPool = false;
+
+	InitTask(ThisAbility, ThisAbility.GetGameplayTaskDefaultPriority());
+	InstanceName = InInstanceName;
+}
+
+void UAbilityTask_PushPawnPooled::ResetPooledTask()
+{
+	Ability = nullptr;
+	InstanceName = NAME_None;
+}
+
+void UAbilityTask_PushPawnPooled::OnDestroy(bool bInOwnerFinished)
+{
+	// A subclass that broadcasts from OnDestroy before calling Super can end the owning ability, which destroys this
+	// task again from within the broadcast. By the time the outer call gets here the inner call has already finished
+	// the task and possibly released it, finishing it again would mark a pooled task as garbage
+	if (bReleasedToPool || IsFinished())
+	{
+		return;
+	}
+
+	if (!bPooled)
+	{
+		// Deactivates the task and marks it as garbage
+		Super::OnDestroy(bInOwnerFinished);
+		return;
+	}
+
+	bPooled = false;
+
+	// End the task the same way UGameplayTask::OnDestroy() does, except it is never marked as garbage
+	TaskState = EGameplayTaskState::Finished;
+	if (TasksComponent.IsValid())
+	{
+		TasksComponent->OnGameplayTaskDeactivated(*this);
+	}
+
+	// Nothing may keep referencing the task once it can be handed out again
+	ReleasedToPoolDelegate.Broadcast(this);
+	ReleasedToPoolDelegate.Clear();
+
+	bReleasedToPool = true;
+	UPushPawnTaskPoolSubsystem::ReleasePooledTask(this, AbilitySystemComponent.Get());
+	ResetPooledTask();
+}
@@ -9,6 +9,7 @@
 #include "IPush.h"
 #include "PushStatics.h"
 #include "PushQuery.h"
+#include "PushPawnStats.h"
 
 #include "TimerManager.h"
 #include "Curves/CurveFloat.h"
@@ -27,6 +28,9 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AbilityTask_PushPawnScan)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scan Hits Accepted"), STAT_PushPawnScanHitsAccepted, STATGROUP_PushPawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scan Hits Rejected"), STAT_PushPawnScanHitsRejected, STATGROUP_PushPawn);
+
 namespace FPushPawnCVars
 {
 #if UE_ENABLE_DEBUG_DRAWING
@@ -87,9 +91,27 @@ void UAbilityTask_PushPawnScan::OnNetSync(UAbilityTask_PushPawnSync* SyncPoint)
 	{
 		SyncPoints.RemoveSingle(SyncPoint);
 	}
+
+	// The scan kept running during the net sync unless it was paused
+	const bool bWasPaused = !PushScanAbility || PushScanAbility->GetNetSyncScanMode() == EPushPawnNetSyncScanMode::Pause;
+
+	if (PushScanAbility && GetWorld())
+	{
+		// Continue never stops scanning or pushing, Buffer holds pushes for the duration
+		const bool bPausedPushes = PushScanAbility->GetNetSyncScanMode() != EPushPawnNetSyncScanMode::Continue;
+		PushScanAbility->OnNetSyncFinished(bPausedPushes ? GetWorld()->TimeSince(NetSyncStartTime) : 0.f);
+	}
 	
 	// Re-activate the timer
-	ActivateTimer();
+	if (bWasPaused)
+	{
+		ActivateTimer();
+	}
+}
+
+void UAbilityTask_PushPawnScan::OnNetSyncReleased(UAbilityTask_PushPawnPooled* SyncPoint)
+{
+	SyncPoints.RemoveSingle(static_cast<UAbilityTask_PushPawnSync*>(SyncPoint));
 }
 
 void UAbilityTask_PushPawnScan::ActivateTimer(EPushPawnPauseType PauseType)
@@ -128,11 +150,21 @@ void UAbilityTask_PushPawnScan::ActivateTimer(EPushPawnPauseType PauseType)
 		}
 #endif
 		
+		NetSyncStartTime = GetWorld()->GetTimeSeconds();
+		PushScanAbility->OnNetSyncStarted();
+
+		// The sync may complete during activation, in which case it has already re-activated the timer if needed
 		UAbilityTask_PushPawnSync* WaitNetSync = UAbilityTask_PushPawnSync::WaitNetSync(Ability);
 		WaitNetSync->OnSync.AddDynamic(this, &ThisClass::OnNetSync);
-		WaitNetSync->ReadyForActivation();
+		WaitNetSync->OnReleasedToPool().AddUObject(this, &ThisClass::OnNetSyncReleased);
 		SyncPoints.Add(WaitNetSync);
-		return;
+		WaitNetSync->ReadyForActivation();
+
+		// Keep scanning during the net sync unless we're pausing
+		if (PushScanAbility->GetNetSyncScanMode() == EPushPawnNetSyncScanMode::Pause)
+		{
+			return;
+		}
 	}
 
 	if (!OnPushPawnScanPauseStateChangedDelegate)
@@ -153,7 +185,13 @@ void UAbilityTask_PushPawnScan::ActivateTimer(EPushPawnPauseType PauseType)
 		if (Ability)
 		{
 			float ScanRate = ScanParams.ScanRate;
-			if (!IsWaitingOnAvatar() && GetAvatarActor())
+			if (bHasScanSnapshot)
+			{
+				// Re-use the state gathered by the scan instead of querying the pushee again
+				ScanRate = UPushStatics::GetPushPawnScanRate(ScanSnapshot.Acceleration, ScanParams);
+				bHasScanSnapshot = false;
+			}
+			else if (!IsWaitingOnAvatar() && GetAvatarActor())
 			{
 				if (APawn* Pawn = Cast<APawn>(GetAvatarActor()))
 				{
@@ -188,6 +226,12 @@ void UAbilityTask_PushPawnScan::Activate()
 {
 	SetWaitingOnAvatar();
 
+	// Build the query params up-front if the avatar is already available
+	if (const AActor* AvatarActor = GetAvatarActor())
+	{
+		UpdateQueryParams(AvatarActor, UPushStatics::GetPusheeInstigator(AvatarActor));
+	}
+
 	ActivateTimer();
 }
 
@@ -209,7 +253,10 @@ void UAbilityTask_PushPawnScan::OnDestroy(bool bInOwnerFinished)
 		OnPushPawnScanPauseStateChangedDelegate = nullptr;
 	}
 
-	for (UAbilityTask_PushPawnSync* WaitNetSync : SyncPoints)
+	// Ending a pooled net sync releases it, which removes it from SyncPoints
+	const TArray<TObjectPtr<UAbilityTask_PushPawnSync>> PendingSyncPoints = MoveTemp(SyncPoints);
+	SyncPoints.Reset();
+	for (UAbilityTask_PushPawnSync* WaitNetSync : PendingSyncPoints)
 	{
 		if (IsValid(WaitNetSync))
 		{
@@ -296,16 +343,20 @@ void UAbilityTask_PushPawnScan::PerformTrace()
         return;
     }
 
+	// Gather the pushee's state once, this is shared with ActivateTimer()
+	ScanSnapshot = UPushStatics::GetPusheeScanSnapshot(Pushee);
+	bHasScanSnapshot = true;
+
 	// Increase the collision size based on the pushee's speed and acceleration
 	float VelocityScalar = 1.f;
 	
 	// Check if the pushee is accelerating
-	const bool bHasAcceleration = UPushStatics::IsPusheeAccelerating(Pushee);
+	const bool bHasAcceleration = UPushStatics::IsPusheeAccelerating(ScanSnapshot.Acceleration);
 
 	// Get the velocity scalar from the curve
 	if (ScanParams.RadiusVelocityScalar)
 	{
-		VelocityScalar = ScanParams.RadiusVelocityScalar->GetFloatValue(UPushStatics::GetPusheeGroundSpeed(Pushee));
+		VelocityScalar = ScanParams.RadiusVelocityScalar->GetFloatValue(UPushStatics::GetPusheeGroundSpeed(ScanSnapshot));
 	}
 
 	// Calculate the radius scalar
@@ -334,22 +385,41 @@ void UAbilityTask_PushPawnScan::PerformTrace()
 		default: break;
 	}
 
-	// Initialize trace params
-	TArray<AActor*> ActorsToIgnore;
-	ActorsToIgnore.Add(AvatarActor);
-	
-	constexpr bool bTraceComplex = false;
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(UAbilityTask_PushPawnScan_Trace), bTraceComplex);
-	Params.AddIgnoredActors(ActorsToIgnore);
+	// Initialize trace params, this is a no-op unless the avatar or ignore list changed
+	UpdateQueryParams(AvatarActor, Pushee);
 
 	// Perform the trace
 	const FVector TraceStart = StartLocation.GetTargetingTransform().GetLocation();
-	FHitResult Hit;
-	ShapeTrace(Hit, GetWorld(), TraceStart, ShapeRotation, ScanParams.TraceChannel, Params, CollisionShape);
+	TArray<FHitResult> Hits;
+	if (ScanParams.QueryType == EPushPawnScanQueryType::ObjectType)
+	{
+		ShapeTraceByObjectType(Hits, GetWorld(), TraceStart, ShapeRotation, ObjectQueryParams, QueryParams, CollisionShape);
+	}
+	else
+	{
+		ShapeTrace(Hits, GetWorld(), TraceStart, ShapeRotation, ScanParams.TraceChannel, QueryParams, CollisionShape);
+	}
 
-	// Append the push targets
+	// Append the push targets from every hit, not only the first, so all nearby pushers are sorted and batched
 	TArray<TScriptInterface<IPusherTarget>> PushTargets;
-	UPushStatics::AppendPushTargetsFromHitResult(Hit, PushTargets);
+	for (const FHitResult& Hit : Hits)
+	{
+		const int32 NumPushTargets = PushTargets.Num();
+		UPushStatics::AppendPushTargetsFromHitResult(Hit, PushTargets);
+
+		// Track how many hits were actually pushers
+		if (Hit.GetActor())
+		{
+			if (PushTargets.Num() > NumPushTargets)
+			{
+				INC_DWORD_STAT(STAT_PushPawnScanHitsAccepted);
+			}
+			else
+			{
+				INC_DWORD_STAT(STAT_PushPawnScanHitsRejected);
+			}
+		}
+	}
 
 	// Update the push options
 	UpdatePushOptions(PushQuery, PushTargets);
@@ -357,7 +427,7 @@ void UAbilityTask_PushPawnScan::PerformTrace()
 #if UE_ENABLE_DEBUG_DRAWING
 	if (FPushPawnCVars::PushPawnScanDebugDraw)
 	{
-		FColor DebugColor = Hit.bBlockingHit ? FColor::Red : FColor::Green;
+		FColor DebugColor = Hits.Num() > 0 ? FColor::Red : FColor::Green;
 		
 		switch (CollisionShape.ShapeType)
 		{
@@ -379,7 +449,7 @@ void UAbilityTask_PushPawnScan::PerformTrace()
 			default: break;
 		}
 		
-		if (Hit.bBlockingHit)
+		for (const FHitResult& Hit : Hits)
 		{
 			DrawDebugSphere(World, Hit.Location, 5, 16, DebugColor, false, CurrentScanRate);
 		}
@@ -390,6 +460,53 @@ void UAbilityTask_PushPawnScan::PerformTrace()
 	ActivateTimer();
 }
 
+void UAbilityTask_PushPawnScan::UpdateQueryParams(const AActor* AvatarActor, const IPusheeInstigator* Pushee)
+{
+	const FPushPawnIgnoreList* IgnoreList = Pushee ? Pushee->GetPushPawnIgnoreList() : nullptr;
+	const uint32 IgnoreRevision = IgnoreList ? IgnoreList->GetRevision() : 0;
+
+	// Nothing changed, keep using the cached params
+	if (QueryParamsAvatar.Get() == AvatarActor && QueryParamsIgnoreRevision == IgnoreRevision)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UAbilityTask_PushPawnScan::UpdateQueryParams);
+
+	QueryParamsAvatar = AvatarActor;
+	QueryParamsIgnoreRevision = IgnoreRevision;
+
+	constexpr bool bTraceComplex = false;
+	QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(UAbilityTask_PushPawnScan_Trace), bTraceComplex, AvatarActor);
+
+	// Add the pushee's persistent ignore list
+	if (IgnoreList)
+	{
+		for (const TWeakObjectPtr<AActor>& IgnoredActor : IgnoreList->GetActors())
+		{
+			if (const AActor* Actor = IgnoredActor.Get())
+			{
+				QueryParams.AddIgnoredActor(Actor);
+			}
+		}
+	}
+
+	// Reject static geometry during broadphase
+	if (ScanParams.bDynamicObjectsOnly)
+	{
+		QueryParams.MobilityType = EQueryMobilityType::Dynamic;
+	}
+
+	ObjectQueryParams = FCollisionObjectQueryParams();
+	if (ScanParams.QueryType == EPushPawnScanQueryType::ObjectType)
+	{
+		for (const TEnumAsByte<ECollisionChannel>& ObjectType : ScanParams.ObjectTypes)
+		{
+			ObjectQueryParams.AddObjectTypesToQuery(ObjectType);
+		}
+	}
+}
+
 void UAbilityTask_PushPawnScan::OnScanPaused(bool bIsPaused)
 {
 #if !UE_BUILD_SHIPPING
@@ -4,6 +4,8 @@
 
 #include "GameFramework/Actor.h"
 #include "AbilitySystemComponent.h"
+#include "PushPawnSubsystem.h"
+#include "PushStatics.h"
 
 #include "Engine/World.h"
 
@@ -15,7 +17,7 @@ UAbilityTask_PushPawnScan_Base::UAbilityTask_PushPawnScan_Base(const FObjectInit
 {
 }
 
-void UAbilityTask_PushPawnScan_Base::ShapeTrace(FHitResult& OutHitResult, const UWorld* World, const FVector& Center,
+void UAbilityTask_PushPawnScan_Base::ShapeTrace(TArray<FHitResult>& OutHitResults, const UWorld* World, const FVector& Center,
 	const FQuat& Rotation, const ECollisionChannel ChannelName, const FCollisionQueryParams& Params, const FCollisionShape& Shape)
 {
 	check(World);
@@ -23,28 +25,79 @@ void UAbilityTask_PushPawnScan_Base::ShapeTrace(FHitResult& OutHitResult, const
 	// Make it move so the sweep registers
 	const FVector End = Center + FVector::UpVector * -0.1f;
 
-	// Perform the trace
-	OutHitResult = FHitResult();
+	// Perform the trace, every hit is kept so all nearby pushers become options
+	OutHitResults.Reset();
+	World->SweepMultiByChannel(OutHitResults, Center, End, Rotation, ChannelName, Shape, Params);
+}
+
+void UAbilityTask_PushPawnScan_Base::ShapeTraceByObjectType(TArray<FHitResult>& OutHitResults, const UWorld* World,
+	const FVector& Center, const FQuat& Rotation, const FCollisionObjectQueryParams& ObjectParams,
+	const FCollisionQueryParams& Params, const FCollisionShape& Shape)
+{
+	check(World);
+
+	// Make it move so the sweep registers
+	const FVector End = Center + FVector::UpVector * -0.1f;
+
+	// Perform the trace, every hit is kept so all nearby pushers become options
+	OutHitResults.Reset();
+	if (ObjectParams.IsValid())
+	{
+		World->SweepMultiByObjectType(OutHitResults, Center, End, Rotation, ObjectParams, Shape, Params);
+	}
+}
+
+void UAbilityTask_PushPawnScan_Base::ShapeTrace(FHitResult& OutHitResult, const UWorld* World, const FVector& Center,
+	const FQuat& Rotation, const ECollisionChannel ChannelName, const FCollisionQueryParams& Params, const FCollisionShape& Shape)
+{
 	TArray<FHitResult> HitResults;
-	World->SweepMultiByChannel(HitResults, Center, End, Rotation, ChannelName, Shape, Params);
+	ShapeTrace(HitResults, World, Center, Rotation, ChannelName, Params, Shape);
+
+	// Only the first hit is returned
+	if (HitResults.Num() > 0)
+	{
+		OutHitResult = HitResults[0];
+	}
+	else
+	{
+		OutHitResult = FHitResult(Center, Center + FVector::UpVector * -0.1f);
+	}
+}
 
-	// Set the trace start and end
-	OutHitResult.TraceStart = Center;
-	OutHitResult.TraceEnd = End;
+void UAbilityTask_PushPawnScan_Base::ShapeTraceByObjectType(FHitResult& OutHitResult, const UWorld* World,
+	const FVector& Center, const FQuat& Rotation, const FCollisionObjectQueryParams& ObjectParams,
+	const FCollisionQueryParams& Params, const FCollisionShape& Shape)
+{
+	TArray<FHitResult> HitResults;
+	ShapeTraceByObjectType(HitResults, World, Center, Rotation, ObjectParams, Params, Shape);
 
-	// If we hit something, set the first hit result
+	// Only the first hit is returned
 	if (HitResults.Num() > 0)
 	{
 		OutHitResult = HitResults[0];
 	}
+	else
+	{
+		OutHitResult = FHitResult(Center, Center + FVector::UpVector * -0.1f);
+	}
 }
 
 void UAbilityTask_PushPawnScan_Base::UpdatePushOptions(const FPushQuery& PushQuery, const TArray<TScriptInterface<IPusherTarget>>& PushTargets)
 {
+	// Our push group, used to reject pushers before gathering their options
+	const IPusheeInstigator* Pushee = UPushStatics::GetPusheeInstigator(PushQuery.RequestingAvatar.Get());
+	const int32 PusheeGroup = Pushee ? Pushee->GetPusheePushGroup() : INDEX_NONE;
+
 	// Iterate over all the push targets and gather their push options
 	TArray<FPushOption> NewOptions;
 	for (const TScriptInterface<IPusherTarget>& PushTarget : PushTargets)
 	{
+		// Reject pushers that the push group matrix doesn't allow to push us
+		if (!UPushPawnSubsystem::IsPushAllowedByGroup(GetWorld(), PushTarget->GetPusherPushGroup(), PusheeGroup))
+		{
+			continue;
+		}
+
 		// Gather the push options
 		TArray<FPushOption> PushOptions;
 		FPushOptionBuilder PushBuilder(PushTarget, PushOptions);
@@ -92,18 +145,21 @@ void UAbilityTask_PushPawnScan_Base::UpdatePushOptions(const FPushQuery& PushQue
 			{
 				if (PushAbilitySpec->Ability->CanActivateAbility(PushAbilitySpec->Handle, AbilitySystemComponent->AbilityActorInfo.Get()))
 				{
+					// Sort keys shared by the client and server, so both trigger the push for the same pusher
+					Option.SortDistance = FVector::Dist(Option.PusheeActorLocation, Option.PusherActorLocation);
+					Option.PusherStableID = UPushStatics::GetStablePushID(UPushStatics::GetActorFromPushTarget(PushTarget));
 					NewOptions.Add(Option);
 				}
 			}
 		}
 	}
 
-	// Sort the options
+	// Sort the options from every hit, the first option is the one that gets pushed so this must be the same on client and server
+	NewOptions.Sort();
+
 	bool bOptionsChanged = false;
 	if (NewOptions.Num() == CurrentOptions.Num())
 	{
-		NewOptions.Sort();
-
 		for (int32 OptionIndex = 0; OptionIndex < NewOptions.Num(); OptionIndex++)
 		{
 			const FPushOption& NewOption = NewOptions[OptionIndex];
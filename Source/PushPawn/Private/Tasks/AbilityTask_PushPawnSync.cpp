@@ -2,6 +2,9 @@
 
 #include "Tasks/AbilityTask_PushPawnSync.h"
 #include "AbilitySystemComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "IPush.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AbilityTask_PushPawnSync)
 
@@ -20,9 +23,26 @@ void UAbilityTask_PushPawnSync::OnSignalCallback()
 	SyncFinished();
 }
 
+void UAbilityTask_PushPawnSync::OnPushSyncEpochReceived()
+{
+	const IPushPawnSyncEpochProvider* SyncEpochProvider = GetPushSyncEpochProvider();
+	if (!SyncEpochProvider || IPushPawnSyncEpochProvider::HasReachedPushSyncEpoch(
+		SyncEpochProvider->GetReceivedPushSyncEpoch(), AwaitedPushSyncEpoch))
+	{
+		SyncFinished();
+	}
+}
+
+IPushPawnSyncEpochProvider* UAbilityTask_PushPawnSync::GetPushSyncEpochProvider() const
+{
+	const APawn* Pawn = Cast<APawn>(GetAvatarActor());
+	IPushPawnSyncEpochProvider* SyncEpochProvider = Pawn ? Cast<IPushPawnSyncEpochProvider>(Pawn->GetMovementComponent()) : nullptr;
+	return SyncEpochProvider && SyncEpochProvider->IsPushSyncEpochEnabled() ? SyncEpochProvider : nullptr;
+}
+
 UAbilityTask_PushPawnSync* UAbilityTask_PushPawnSync::WaitNetSync(class UGameplayAbility* OwningAbility)
 {
-	UAbilityTask_PushPawnSync* MyObj = NewAbilityTask<UAbilityTask_PushPawnSync>(OwningAbility);
+	UAbilityTask_PushPawnSync* MyObj = NewPooledAbilityTask<UAbilityTask_PushPawnSync>(OwningAbility);
 	return MyObj;
 }
 
@@ -30,6 +50,31 @@ void UAbilityTask_PushPawnSync::Activate()
 {
 	FScopedPredictionWindow ScopedPrediction(AbilitySystemComponent.Get(), IsPredictingClient());
 
+	// Send the signal with the client's moves instead of a reliable RPC
+	if (IPushPawnSyncEpochProvider* SyncEpochProvider = GetPushSyncEpochProvider())
+	{
+		if (IsPredictingClient())
+		{
+			SyncEpochProvider->AdvancePushSyncEpoch();
+			SyncFinished();
+			return;
+		}
+		
+		if (IsForRemoteClient())
+		{
+			AwaitedPushSyncEpoch = SyncEpochProvider->AwaitNextPushSyncEpoch();
+			if (IPushPawnSyncEpochProvider::HasReachedPushSyncEpoch(SyncEpochProvider->GetReceivedPushSyncEpoch(), AwaitedPushSyncEpoch))
+			{
+				SyncFinished();
+			}
+			else
+			{
+				PushSyncEpochHandle = SyncEpochProvider->OnPushSyncEpochReceived().AddUObject(this, &ThisClass::OnPushSyncEpochReceived);
+			}
+			return;
+		}
+	}
+
 	if (AbilitySystemComponent.IsValid())
 	{
 		if (IsPredictingClient())
@@ -55,6 +100,37 @@ void UAbilityTask_PushPawnSync::Activate()
 	}
 }
 
+void UAbilityTask_PushPawnSync::OnDestroy(bool bInOwnerFinished)
+{
+	// A pooled task stays valid, so make sure a stale signal can't reach us once we're re-used
+	if (IsPooled() && AbilitySystemComponent.IsValid() && Ability && ReplicatedEventToListenFor != EAbilityGenericReplicatedEvent::MAX)
+	{
+		AbilitySystemComponent->AbilityReplicatedEventDelegate(ReplicatedEventToListenFor, GetAbilitySpecHandle(),
+			GetActivationPredictionKey()).RemoveAll(this);
+	}
+
+	if (PushSyncEpochHandle.IsValid())
+	{
+		if (IPushPawnSyncEpochProvider* SyncEpochProvider = GetPushSyncEpochProvider())
+		{
+			SyncEpochProvider->OnPushSyncEpochReceived().Remove(PushSyncEpochHandle);
+		}
+		PushSyncEpochHandle.Reset();
+	}
+
+	Super::OnDestroy(bInOwnerFinished);
+}
+
+void UAbilityTask_PushPawnSync::ResetPooledTask()
+{
+	Super::ResetPooledTask();
+
+	OnSync.Clear();
+	ReplicatedEventToListenFor = EAbilityGenericReplicatedEvent::MAX;
+	AwaitedPushSyncEpoch = 0;
+	PushSyncEpochHandle.Reset();
+}
+
 void UAbilityTask_PushPawnSync::SyncFinished()
 {
 	if (IsValid(this))
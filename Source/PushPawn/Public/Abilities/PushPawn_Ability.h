@@ -22,12 +22,23 @@ protected:
 	/** Blueprint logic runs in a virtual machine with severe performance overhead. This ability is activated very often. */
 	UPROPERTY(EditDefaultsOnly, AdvancedDisplay, Category=PushPawn)
 	bool bAllowBlueprintImplementation = false;
+
+	/**
+	 * Re-use this ability's PushPawn tasks from a per ability system component pool instead of creating a new UObject
+	 * for every push or net sync, reducing GC pressure when pushing frequently
+	 * Simulated tasks such as UAbilityTask_PushPawnForce replicate to simulated proxies and are never pooled
+	 * @see UAbilityTask_PushPawnPooled
+	 */
+	UPROPERTY(EditDefaultsOnly, AdvancedDisplay, Category=PushPawn)
+	bool bPoolAbilityTasks = false;
 	
 public:
 	UPushPawn_Ability(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual bool CanActivatePushPawnAbility(const AActor* AvatarActor) const { return true; }
 
+	bool ShouldPoolAbilityTasks() const { return bPoolAbilityTasks; }
+
 	virtual bool CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
 		const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags,
 		FGameplayTagContainer* OptionalRelevantTags) const override final;
@@ -8,6 +8,7 @@
 #include "PushPawn_Action.generated.h"
 
 class ACharacter;
+class UAbilityTask_PushPawnForce;
 
 /**
  * A completed C++ implementation of the PushPawn_Action_Base class
@@ -26,6 +27,9 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
 	FPushPawnActionParams PushParams;
 
+public:
+	virtual const FPushPawnActionParams* GetPushActionParams() const override { return &PushParams; }
+
 protected:
 	// Cache transient data so derived classes can access it
 
@@ -52,6 +56,9 @@ protected:
 
 	UPROPERTY(BlueprintReadOnly, Transient, DuplicateTransient, Category=PushPawn)
 	bool bOverrideStrength = false;
+
+	UPROPERTY(BlueprintReadOnly, Transient, DuplicateTransient, Category=PushPawn)
+	TObjectPtr<UAbilityTask_PushPawnForce> PushTask = nullptr;
 	
 protected:
 	virtual bool ActivatePushPawnAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
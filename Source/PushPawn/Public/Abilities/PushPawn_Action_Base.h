@@ -4,8 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "PushPawn_Ability.h"
+#include "PushTypes.h"
 #include "PushPawn_Action_Base.generated.h"
 
+struct FPushPawnActionParams;
+
 /**
  * The base class for all PushPawn actions
  * This is a lightweight class that cannot use tags or other advanced features to reduce performance overhead
@@ -20,10 +23,37 @@ class PUSHPAWN_API UPushPawn_Action_Base : public UPushPawn_Ability
 {
 	GENERATED_BODY()
 
+protected:
+	/** How the server validates pushes predicted by clients */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Validation")
+	FPushPawnValidationParams ValidationParams;
+
 public:
 	virtual bool CanActivatePushPawnAbility(const AActor* AvatarActor) const override;
 
+	/**
+	 * Called by the scan when this action is already active, instead of re-triggering it
+	 * Continuous actions can consume the push to update themselves, avoiding a new activation and prediction key
+	 * @return True if the push was consumed, otherwise the action is re-triggered as normal
+	 */
+	virtual bool ConsumeContinuousPush(const FGameplayEventData& EventData) { return false; }
+
+	/**
+	 * @return The parameters this action applies to the pushee, if it has any
+	 * Used to apply pushes without activating the action, e.g. UPushPawnAISolverSubsystem
+	 */
+	virtual const FPushPawnActionParams* GetPushActionParams() const { return nullptr; }
+
 protected:
+	/**
+	 * Validate a push predicted by a client, only does anything on the server for remotely controlled pawns
+	 * The bounds of every push are checked, a fraction of pushes are also compared to the server's own state
+	 * @see FPushPawnValidationParams
+	 * @return False if the push is invalid and must be rejected
+	 */
+	bool ValidateClientPush(const FGameplayAbilityActorInfo* ActorInfo, const APawn* Pushee, const APawn* Pusher,
+		const FGameplayEventData& EventData, bool bDistanceCheck2D) const;
+
 	/** Helper for derived actions to retrieve p.PushPawn.Action.Debug.Draw which is declared in UPushPawn_Action cpp */
 	static bool WantsPushPawnActionDebugDraw();
 };
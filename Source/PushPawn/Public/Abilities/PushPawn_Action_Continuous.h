@@ -0,0 +1,63 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PushPawn_Action.h"
+#include "PushPawn_Action_Continuous.generated.h"
+
+/**
+ * A push action that remains active while contact persists
+ * Subsequent pushes replace the task's root motion source with the new force, instead of ending and re-activating
+ * the ability with a new task and activation prediction key for every push
+ *
+ * The predicting client applies the push locally and sends it to the server as replicated target data, this is still
+ * one server RPC for every continued push, use ContinuousPushInterval to limit how often that happens
+ * The action ends once no push has been received for FPushPawnActionParams::Duration
+ */
+UCLASS(Blueprintable)
+class PUSHPAWN_API UPushPawn_Action_Continuous final : public UPushPawn_Action
+{
+	GENERATED_BODY()
+
+protected:
+	/**
+	 * Re-activate the action after it has been continuously active for this long, allowing it to re-sync
+	 * Set to 0 to disable
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", Delta="0.1", ForceUnits="s"))
+	float MaxContinuousDuration = 3.f;
+
+	/**
+	 * Continued pushes sooner than this after the last one are absorbed by the active force instead of being applied
+	 * and sent to the server, limiting the rate of server RPCs during sustained contact
+	 * Limited to half of FPushPawnActionParams::Duration so that the force doesn't lapse between pushes
+	 * Set to 0 to send every push
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", Delta="0.01", ForceUnits="s"))
+	float ContinuousPushInterval = 0.f;
+
+	/** When the action was last activated */
+	UPROPERTY(BlueprintReadOnly, Transient, DuplicateTransient, Category=PushPawn)
+	float ContinuousStartTime = 0.f;
+
+	/** When a push was last applied, either by activation or as a continued push */
+	UPROPERTY(BlueprintReadOnly, Transient, DuplicateTransient, Category=PushPawn)
+	float LastContinuousPushTime = 0.f;
+
+public:
+	virtual bool ConsumeContinuousPush(const FGameplayEventData& EventData) override;
+
+protected:
+	virtual bool ActivatePushPawnAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
+
+	virtual void EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled) override;
+
+	/** Combine the pushes contained in the target data and apply them to the active push task */
+	bool ApplyContinuousPush(const FGameplayAbilityTargetDataHandle& TargetData);
+
+	/** Server receives continued pushes from the predicting client */
+	void OnContinuousPushTargetDataReceived(const FGameplayAbilityTargetDataHandle& TargetData, FGameplayTag ApplicationTag);
+};
@@ -0,0 +1,43 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PushPawn_Action_Base.h"
+#include "PushTypes.h"
+#include "PushPawn_Action_NonInstanced.generated.h"
+
+/**
+ * A non-instanced implementation of the push action, executed on the CDO
+ * Computes everything on the stack and applies the root motion source directly, then ends immediately
+ *
+ * This avoids an ability instance per actor and a task per push, which adds up when thousands of AI each carry push
+ * abilities. In exchange there is no transient state for derived classes, no Blueprint implementation, and no
+ * continuous or pooled task support. The root motion source ends itself after FPushPawnActionParams::Duration.
+ *
+ * Works with any pawn, not only characters. Pawns without a UCharacterMovementComponent are pushed by a registered
+ * IPushPawnForceBackend, e.g. the PushPawnMover plugin for UMoverComponent.
+ *
+ * Intended for C++ users, derive from this and mark your subclass final.
+ * @note Epic has deprecated NonInstanced abilities as of UE5.5, use UPushPawn_Action there
+ */
+UCLASS(Blueprintable)
+class PUSHPAWN_API UPushPawn_Action_NonInstanced : public UPushPawn_Action_Base
+{
+	GENERATED_BODY()
+
+protected:
+	/** The parameters to apply to the pushee */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
+	FPushPawnActionParams PushParams;
+
+public:
+	virtual const FPushPawnActionParams* GetPushActionParams() const override { return &PushParams; }
+
+public:
+	UPushPawn_Action_NonInstanced(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+protected:
+	virtual bool ActivatePushPawnAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
+};
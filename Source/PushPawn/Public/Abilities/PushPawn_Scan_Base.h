@@ -38,6 +38,46 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AdvancedDisplay, Category=PushPawn)
 	bool bAutoActivateOnGrantAbility = true;
 
+protected:
+	/**
+	 * If true, every pusher in range is sent with a single push activation instead of only the closest
+	 * Saves an activation RPC for each additional pusher, the push action combines their forces
+	 * Requires a push action that supports batched pushes, such as UPushPawn_Action
+	 * Batched pushes don't carry their pusher, so the server can only bounds check them and cap their number and
+	 * combined force, full validation only covers the first pusher. Prefer it for listen servers or trusted clients
+	 * @see UPushStatics::GetNumPushesInEventData()
+	 * @see FPushPawnValidationParams::MaxBatchedPushes
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Batching")
+	bool bBatchPushes = false;
+
+	/** Maximum number of pushers to send with a single push activation */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Batching", meta=(ClampMin="1", UIMin="1", UIMax="8", EditCondition="bBatchPushes", EditConditionHides))
+	int32 MaxBatchedPushes = 4;
+
+	/** The number of push activation RPCs that were avoided by batching pushes */
+	UPROPERTY(BlueprintReadOnly, Category="PushPawn|Batching")
+	int32 PushRPCsSaved = 0;
+
+protected:
+	/**
+	 * If true, when both we and the pusher are AI on the server, the push is solved by UPushPawnAISolverSubsystem
+	 * instead of activating the push action. Nobody predicts AI, so this skips the activation, target data and net
+	 * sync overhead. Pushes involving a player always activate the push action.
+	 * The push action's CanActivateAbility() still gates the push, but its cost and cooldown are never committed
+	 * Requires a push action that provides its params, such as UPushPawn_Action
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|AI Solver")
+	bool bUseServerAISolver = false;
+
+	/**
+	 * If true, when the avatar is set on the server, it is teleported apart from any other pawns set during the same
+	 * frame before it starts pushing. Prevents a storm of pushes and net syncs when a wave spawns on top of each other
+	 * @see UPushPawnSpawnSeparationSubsystem::SeparatePawns()
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Spawn")
+	bool bSeparateOnSpawn = false;
+
 protected:
 	/**
 	 * If FALSE, will never net sync, and de-sync is guaranteed
@@ -46,6 +86,17 @@ protected:
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Net Sync|Advanced", meta=(ClampMin="0", UIMin="0", DisplayName="Enable Wait For Net Sync (ADVANCED USE ONLY)"))
 	bool bEnableWaitForNetSync = true;
+
+	/**
+	 * What the scan does while waiting for a net sync
+	 * Pausing leaves the pawn without soft collision for up to a round trip, so it runs into hard collisions instead,
+	 * which cause corrections of their own on high latency connections
+	 * Continue tags pushes made during the net sync with PushPawn.NetSync.Pending, they were predicted before the server
+	 * caught up so the server always fully validates them, @see UPushPawn_Action_Base::ValidationParams
+	 * Buffer holds only the latest push, earlier pushes during the net sync are dropped
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Net Sync", meta=(EditCondition="bEnableWaitForNetSync", EditConditionHides))
+	EPushPawnNetSyncScanMode NetSyncScanMode = EPushPawnNetSyncScanMode::Pause;
 	
 	/**
 	 * The number of pushes that can be triggered before a net sync is required
@@ -87,6 +138,69 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category="PushPawn|Net Sync")
 	int32 TriggeredPushesSinceLastNetSync = 0;
 
+	/** The number of net syncs this ability has waited for */
+	UPROPERTY(BlueprintReadOnly, Category="PushPawn|Net Sync")
+	int32 NumNetSyncs = 0;
+
+	/** Total time the scan was paused waiting for net syncs */
+	UPROPERTY(BlueprintReadOnly, Category="PushPawn|Net Sync", meta=(ForceUnits="s"))
+	float NetSyncPauseTime = 0.f;
+
+protected:
+	/**
+	 * If true, the predicting client stretches the net sync interval while its pushes aren't corrected by the server,
+	 * and tightens it when they are. Net syncs are also kept a few round trips apart.
+	 * The server stops syncing on its own schedule and syncs whenever the client does instead. On the server the sync
+	 * is then only a barrier that consumes the client's sync, the server never pauses its own scan to wait for it.
+	 * Corrections are measured by movement components implementing IPushPawnMovementAccumulator, such as
+	 * UPushPawnMovementComponent, which only counts corrections that follow a move carrying a push. Otherwise only
+	 * the round trip time is used.
+	 * @see NetSyncIntervalScale
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Net Sync|Adaptive", meta=(EditCondition="bEnableWaitForNetSync", EditConditionHides))
+	bool bAdaptiveNetSync = false;
+
+	/** The net sync interval can't be tightened below this scale */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Net Sync|Adaptive", meta=(ClampMin="0.1", UIMin="0.1", UIMax="1", Delta="0.05", ForceUnits="x", EditCondition="bEnableWaitForNetSync&&bAdaptiveNetSync", EditConditionHides))
+	float MinNetSyncIntervalScale = 0.5f;
+
+	/** The net sync interval can't be stretched beyond this scale */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Net Sync|Adaptive", meta=(ClampMin="1", UIMin="1", UIMax="8", Delta="0.1", ForceUnits="x", EditCondition="bEnableWaitForNetSync&&bAdaptiveNetSync", EditConditionHides))
+	float MaxNetSyncIntervalScale = 4.f;
+
+	/** Multiplies the net sync interval after pushing without any corrections */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Net Sync|Adaptive", meta=(ClampMin="1", UIMin="1", UIMax="2", Delta="0.05", ForceUnits="x", EditCondition="bEnableWaitForNetSync&&bAdaptiveNetSync", EditConditionHides))
+	float NetSyncIntervalGrowth = 1.25f;
+
+	/** Multiplies the net sync interval after pushing resulted in a correction */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Net Sync|Adaptive", meta=(ClampMin="0.1", UIMin="0.1", ClampMax="1", UIMax="1", Delta="0.05", ForceUnits="x", EditCondition="bEnableWaitForNetSync&&bAdaptiveNetSync", EditConditionHides))
+	float NetSyncIntervalShrink = 0.5f;
+
+	/**
+	 * Net syncs are never closer together than this many round trips, there is no point in syncing again before the
+	 * previous sync could have reached the server
+	 * Set to 0 to disable
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Net Sync|Adaptive", meta=(ClampMin="0", UIMin="0", UIMax="8", Delta="0.5", ForceUnits="x", EditCondition="bEnableWaitForNetSync&&bAdaptiveNetSync", EditConditionHides))
+	float MinNetSyncRoundTrips = 2.f;
+
+	/** Scales MinNetSyncDelay, NetSyncDelayAfterPush, NetSyncDelayWithoutPush and MaxPushesUntilNetSync */
+	UPROPERTY(BlueprintReadOnly, Category="PushPawn|Net Sync|Adaptive")
+	float NetSyncIntervalScale = 1.f;
+
+	/** Round trip time sampled at the last net sync */
+	UPROPERTY(BlueprintReadOnly, Category="PushPawn|Net Sync|Adaptive", meta=(ForceUnits="s"))
+	float NetSyncRoundTripTime = 0.f;
+
+	/** The movement component's correction count at the last net sync */
+	int32 LastNumClientCorrections = INDEX_NONE;
+
+	/** True while the scan task is waiting for a net sync and NetSyncScanMode isn't Pause */
+	bool bNetSyncInProgress = false;
+
+	/** A push was held during the net sync, @see EPushPawnNetSyncScanMode::Buffer */
+	bool bHasBufferedPush = false;
+
 protected:
 	UPROPERTY(BlueprintReadOnly, Category=PushPawn)
 	float LastPushTime = 0.f;
@@ -111,6 +225,21 @@ protected:
 	UFUNCTION(BlueprintCallable, Category=PushPawn)
 	void TriggerPush();
 
+	/**
+	 * Compute the push target data for a single push option
+	 * @return Null if the pushee can't be pushed or the pusher can't push
+	 */
+	TSharedPtr<FGameplayAbilityTargetData> MakePushTargetData(const FPushOption& PushOption) const;
+
+	/** @return True if the push action is already active and consumed the push, e.g. UPushPawn_Action_Continuous */
+	bool ConsumeContinuousPush(const FPushOption& PushOption, const FGameplayEventData& Payload) const;
+
+	/** @return True if bUseServerAISolver is enabled and our avatar is AI on the server */
+	bool IsUsingServerAISolver() const;
+
+	/** Hand the push to UPushPawnAISolverSubsystem, @return False if the push must be activated as normal */
+	bool QueueServerAIPush(const FPushOption& PushOption) const;
+
 protected:
 	/**
 	 * Get the base scan range for the pawn
@@ -141,4 +270,19 @@ public:
 
 	/** Reset the number of pushes since the last net sync */
 	virtual void ConsumeWaitForNetSync();
+
+	EPushPawnNetSyncScanMode GetNetSyncScanMode() const { return NetSyncScanMode; }
+
+	/** Called by the scan task when it starts waiting for a net sync */
+	virtual void OnNetSyncStarted();
+
+	/** Called by the scan task when a net sync finishes, @param PauseTime How long the scan was paused */
+	virtual void OnNetSyncFinished(float PauseTime);
+
+protected:
+	/** Stretch or tighten NetSyncIntervalScale based on corrections since the last net sync, predicting client only */
+	void UpdateAdaptiveNetSync();
+
+	/** @return True if we're the server and the client has already signalled its next net sync */
+	bool HasPendingClientNetSync() const;
 };
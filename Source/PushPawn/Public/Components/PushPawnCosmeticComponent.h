@@ -0,0 +1,66 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PushPawnComponent.h"
+#include "PushPawnCosmeticComponent.generated.h"
+
+/**
+ * Cosmetic soft collision for simulated proxies
+ *
+ * Simulated proxies never scan or push, so on clients they visibly overlap each other until the server separates
+ * them. Characters with this component have their mesh nudged apart from nearby pawns on clients, only while they are
+ * a simulated proxy. The capsule, movement and replication are untouched, it is purely visual.
+ *
+ * Solved by UPushPawnCosmeticSubsystem with a per frame budget and distance culling
+ */
+UCLASS(ClassGroup=(PushPawn), meta=(BlueprintSpawnableComponent))
+class PUSHPAWN_API UPushPawnCosmeticComponent : public UPushPawnComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** Meshes are nudged apart while the pawns are closer than their combined radius scaled by this */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=PushPawn, meta=(ClampMin="0", UIMin="0", UIMax="2", Delta="0.05", ForceUnits="x"))
+	float CosmeticRadiusScalar = 1.f;
+
+	/** The mesh is never offset further than this from the capsule */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=PushPawn, meta=(ClampMin="0", UIMin="0", UIMax="100", ForceUnits="cm"))
+	float MaxCosmeticOffset = 25.f;
+
+	/** How quickly the mesh moves towards its offset */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=PushPawn, meta=(ClampMin="0", UIMin="0", UIMax="30"))
+	float CosmeticInterpSpeed = 8.f;
+
+protected:
+	/** World space offset the mesh is moving towards */
+	FVector TargetOffset = FVector::ZeroVector;
+
+	/** World space offset currently applied to the mesh */
+	FVector CurrentOffset = FVector::ZeroVector;
+
+	/** Offset relative to the capsule that was added to the mesh, removed before applying the next offset */
+	FVector AppliedRelativeOffset = FVector::ZeroVector;
+
+public:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** @return True if our owner is currently a simulated proxy that should have its mesh offset */
+	bool WantsCosmeticPush() const;
+
+	/** @return True if the mesh is offset, or moving towards an offset */
+	bool HasCosmeticOffset() const { return !CurrentOffset.IsZero() || !TargetOffset.IsZero(); }
+
+	void SetTargetOffset(const FVector& InTargetOffset) { TargetOffset = InTargetOffset; }
+
+	/** Move the mesh towards the target offset */
+	void UpdateCosmeticOffset(float DeltaTime);
+
+	/** Snap the mesh back to the capsule */
+	void ResetCosmeticOffset();
+
+protected:
+	void ApplyCosmeticOffset(const FVector& WorldOffset);
+};
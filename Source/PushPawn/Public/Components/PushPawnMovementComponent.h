@@ -0,0 +1,179 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "IPush.h"
+#include "PushPawnMovementComponent.generated.h"
+
+/**
+ * Saved move that records the push velocity applied during the move, so it can be replayed and sent to the server
+ */
+class PUSHPAWN_API FSavedMove_PushPawn : public FSavedMove_Character
+{
+	using Super = FSavedMove_Character;
+
+public:
+	/** Push velocity pending at the start of this move */
+	FVector SavedPushVelocity = FVector::ZeroVector;
+
+	/** Net sync epoch at the start of this move */
+	uint8 SavedPushSyncEpoch = 0;
+
+	virtual void Clear() override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual bool IsImportantMove(const FSavedMovePtr& LastAckedMove) const override;
+};
+
+class PUSHPAWN_API FNetworkPredictionData_Client_PushPawn : public FNetworkPredictionData_Client_Character
+{
+	using Super = FNetworkPredictionData_Client_Character;
+
+public:
+	FNetworkPredictionData_Client_PushPawn(const UCharacterMovementComponent& ClientMovement)
+		: Super(ClientMovement)
+	{}
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
+
+/**
+ * Network move data carrying the push velocity applied during the move
+ * Costs a single bit when there is no push, otherwise a FVector_NetQuantize10
+ * Also carries the net sync epoch, a byte, if UPushPawnMovementComponent::bSendNetSyncWithMoves is enabled
+ */
+struct PUSHPAWN_API FPushPawnNetworkMoveData : public FCharacterNetworkMoveData
+{
+	using Super = FCharacterNetworkMoveData;
+
+	FVector_NetQuantize10 PushVelocity = FVector::ZeroVector;
+
+	uint8 PushSyncEpoch = 0;
+
+	virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+};
+
+struct PUSHPAWN_API FPushPawnNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+	FPushPawnNetworkMoveDataContainer();
+
+	FPushPawnNetworkMoveData PushPawnMoveData[3];
+};
+
+/**
+ * Character movement component that applies pushes directly, without root motion sources
+ *
+ * Root motion sources are heavy for tiny soft-collision nudges, each carries its own state, is serialized in saved
+ * moves and is replayed during corrections. This accumulates push velocity deltas instead, applies them in
+ * CalcVelocity(), and sends them to the server with the client's moves as a single compressed vector.
+ *
+ * Selected by FPushPawnActionParams::ForceBackend
+ *
+ * Can also send PushPawn's net syncs with the client's moves, @see bSendNetSyncWithMoves
+ */
+UCLASS()
+class PUSHPAWN_API UPushPawnMovementComponent
+	: public UCharacterMovementComponent
+	, public IPushPawnMovementAccumulator
+	, public IPushPawnSyncEpochProvider
+{
+	GENERATED_BODY()
+
+protected:
+	/** If true, pushes never affect Z velocity, the same as a root motion source that ignores Z accumulation */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Character Movement: PushPawn")
+	bool bIgnorePushZ = true;
+
+	/**
+	 * If true, PushPawn's net syncs are sent as an epoch with every move instead of a reliable RPC
+	 * Moves are unreliable, but every subsequent move repeats the epoch, so the server still catches up
+	 * Costs a byte per move
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Character Movement: PushPawn")
+	bool bSendNetSyncWithMoves = false;
+
+	/**
+	 * Server, validated push velocity that hasn't been received with the client's moves within this time is discarded
+	 * so an unused allowance can't be spent on a fabricated push later
+	 * The activation RPC and the client's moves aren't ordered, so a push received with a move before its activation
+	 * is held for this long too, and applied if the activation authorizes it in time
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Character Movement: PushPawn", meta=(ClampMin="0", UIMin="0", Delta="0.1", ForceUnits="s"))
+	float PushAuthorizationTimeout = 1.f;
+
+	/** Push velocity that will be applied during the next movement update */
+	FVector PendingPushVelocity = FVector::ZeroVector;
+
+	/** Server, push velocity from validated push activations that the client's moves may still claim */
+	FVector AuthorizedPushVelocity = FVector::ZeroVector;
+
+	/** Server, when push velocity was last authorized */
+	float LastPushAuthorizationTime = 0.f;
+
+	/** Server, push velocity received with the client's moves before an activation authorized it */
+	FVector UnclaimedPushVelocity = FVector::ZeroVector;
+
+	/** Server, when push velocity was first held as unclaimed */
+	float LastUnclaimedPushTime = 0.f;
+
+	FPushPawnNetworkMoveDataContainer PushPawnMoveDataContainer;
+
+	/** The number of corrections received from the server while predicting, that followed a move carrying a push */
+	int32 NumClientCorrections = 0;
+
+	/** Predicting client, the net sync epoch sent with our moves */
+	uint8 PushSyncEpoch = 0;
+
+	/** Server, the epoch the most recent net sync waited for */
+	uint8 AwaitedPushSyncEpoch = 0;
+
+	/** Server, the latest epoch received with the client's moves */
+	uint8 ReceivedPushSyncEpoch = 0;
+
+	FSimpleMulticastDelegate PushSyncEpochReceivedDelegate;
+
+public:
+	UPushPawnMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void AddPushVelocity(const FVector& DeltaVelocity) override;
+	virtual void AuthorizePushVelocity(const FVector& DeltaVelocity) override;
+	virtual int32 GetNumClientCorrections() const override { return NumClientCorrections; }
+
+	virtual bool IsPushSyncEpochEnabled() const override { return bSendNetSyncWithMoves; }
+	virtual void AdvancePushSyncEpoch() override { PushSyncEpoch++; }
+	virtual uint8 AwaitNextPushSyncEpoch() override { return ++AwaitedPushSyncEpoch; }
+	virtual uint8 GetAwaitedPushSyncEpoch() const override { return AwaitedPushSyncEpoch; }
+	virtual uint8 GetReceivedPushSyncEpoch() const override { return ReceivedPushSyncEpoch; }
+	virtual FSimpleMulticastDelegate& OnPushSyncEpochReceived() override { return PushSyncEpochReceivedDelegate; }
+
+	uint8 GetPushSyncEpoch() const { return PushSyncEpoch; }
+	void SetPushSyncEpoch(uint8 InPushSyncEpoch) { PushSyncEpoch = InPushSyncEpoch; }
+
+	const FVector& GetPendingPushVelocity() const { return PendingPushVelocity; }
+	void SetPendingPushVelocity(const FVector& InPushVelocity) { PendingPushVelocity = InPushVelocity; }
+
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+protected:
+	virtual void CalcVelocity(float DeltaTime, float Friction, bool bFluid, float BrakingDeceleration) override;
+
+	virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel) override;
+
+	/** Pending push velocity that the movement mode didn't apply, e.g. in custom modes, is discarded */
+	virtual void OnMovementUpdated(float DeltaSeconds, const FVector& OldLocation, const FVector& OldVelocity) override;
+
+	/**
+	 * Server, limit the push velocity the client sent with a move to the authorized push velocity
+	 * @return The push velocity to apply, zero if the client's push wasn't authorized
+	 */
+	FVector ConsumeAuthorizedPushVelocity(const FVector& ClientPushVelocity);
+
+	/** @return True if a move up to TimeStamp that the server hasn't acknowledged yet, or the last acknowledged move, carried a push */
+	bool HasPushMoveBefore(float TimeStamp) const;
+
+	virtual void ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse) override;
+};
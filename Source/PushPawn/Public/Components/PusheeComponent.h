@@ -6,6 +6,7 @@
 #include "IPush.h"
 #include "PushPawnComponent.h"
 #include "CollisionShape.h"
+#include "PushTypes.h"
 #include "PusheeComponent.generated.h"
 
 
@@ -20,6 +21,33 @@ class PUSHPAWN_API UPusheeComponent
 {
 	GENERATED_BODY()
 
+protected:
+	/**
+	 * The push group (e.g. team or faction) we belong to, INDEX_NONE to opt out
+	 * @see UPushPawnSubsystem
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=PushPawn, meta=(ClampMin="-1", UIMin="-1", ClampMax="31", UIMax="31"))
+	int32 PushGroup = INDEX_NONE;
+
+	/** Actors that our scan should never consider, e.g. mounted riders or carried NPCs */
+	UPROPERTY(Transient, DuplicateTransient)
+	FPushPawnIgnoreList PushIgnoreList;
+
+public:
+	/** Our scan will no longer consider this actor */
+	UFUNCTION(BlueprintCallable, Category=PushPawn)
+	void AddPushIgnoredActor(AActor* Actor) { PushIgnoreList.Add(Actor); }
+
+	/** Our scan will consider this actor again */
+	UFUNCTION(BlueprintCallable, Category=PushPawn)
+	void RemovePushIgnoredActor(AActor* Actor) { PushIgnoreList.Remove(Actor); }
+
+	/** Our scan will consider all previously ignored actors again */
+	UFUNCTION(BlueprintCallable, Category=PushPawn)
+	void ClearPushIgnoredActors() { PushIgnoreList.Reset(); }
+
+	virtual const FPushPawnIgnoreList* GetPushPawnIgnoreList() const override { return &PushIgnoreList; }
+
 public:
 	/**
 	 * Prevents unnecessary ability activation
@@ -31,6 +59,9 @@ public:
 	/** @return True if we can currently be pushed by the PusherActor */
 	virtual bool CanBePushedBy(const AActor* PusherActor) const override PURE_VIRTUAL(UPusheeComponent::CanBePushedBy, return false;);
 
+	/** @return The push group we belong to, INDEX_NONE to opt out */
+	virtual int32 GetPusheePushGroup() const override { return PushGroup; }
+
 	/** @return Optional runtime strength scaling to change how much the pushee is pushed */
 	virtual float GetPusheeStrengthScalar() const override { return 1.f; }
 
@@ -58,6 +89,12 @@ public:
 	 */
 	virtual bool IsPusheeMovingOnGround() const override PURE_VIRTUAL(UPusheeComponent::IsPusheeMovingOnGround, return true;);
 
+	/**
+	 * Optionally, gather acceleration, velocity and IsMovingOnGround in a single call
+	 * @return False to fall back to GetPusheeAcceleration(), GetPusheeVelocity() and IsPusheeMovingOnGround()
+	 */
+	virtual bool GetPusheeScanSnapshot(FPusheeScanSnapshot& OutSnapshot) const override { return false; }
+
 	/**
 	 * Get the collision shape of the pushee.
 	 * 
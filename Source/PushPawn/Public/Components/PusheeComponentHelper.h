@@ -68,6 +68,15 @@ public:
 	bool K2_IsPusheeMovingOnGround() const;
 	virtual bool IsPusheeMovingOnGround() const override { return K2_IsPusheeMovingOnGround(); }
 
+	/**
+	 * Optionally, gather acceleration, velocity and IsMovingOnGround in a single call
+	 * Implementing this reduces the scan to a single Blueprint call instead of one per getter
+	 * @return False to fall back to Get Pushee Acceleration, Get Pushee Velocity and Is Pushee Moving On Ground
+	 */
+	UFUNCTION(BlueprintPure, BlueprintImplementableEvent, Category=PushPawn, meta=(DisplayName="Get Pushee Scan Snapshot"))
+	bool K2_GetPusheeScanSnapshot(FPusheeScanSnapshot& Snapshot) const;
+	virtual bool GetPusheeScanSnapshot(FPusheeScanSnapshot& OutSnapshot) const override { return K2_GetPusheeScanSnapshot(OutSnapshot); }
+
 	/**
 	 * Get the collision shape of the pushee.
 	 * 
@@ -15,6 +15,14 @@ class PUSHPAWN_API UPusherComponent
 {
 	GENERATED_BODY()
 
+protected:
+	/**
+	 * The push group (e.g. team or faction) we belong to, INDEX_NONE to opt out
+	 * @see UPushPawnSubsystem
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=PushPawn, meta=(ClampMin="-1", UIMin="-1", ClampMax="31", UIMax="31"))
+	int32 PushGroup = INDEX_NONE;
+
 public:
 	/** Fills OptionBuilder with FPushOption, which contains data such as the push ability and useful vectors */
 	virtual void GatherPushOptions(const FPushQuery& PushQuery, FPushOptionBuilder& OptionBuilder) override PURE_VIRTUAL(UPusherComponent::GatherPushOptions, ;);
@@ -32,6 +40,9 @@ public:
 	/** @return True if we can currently push the PusheeActor */
 	virtual bool CanPushPawn(const AActor* PusheeActor) const override PURE_VIRTUAL(UPusheeComponent::CanPushPawn, return false;);
 
+	/** @return The push group we belong to, INDEX_NONE to opt out */
+	virtual int32 GetPusherPushGroup() const override { return PushGroup; }
+
 	/** @return Optional runtime strength scaling to change how much the pusher pushes the pushee */
 	virtual float GetPusherStrengthScalar() const override { return 1.f; }
 
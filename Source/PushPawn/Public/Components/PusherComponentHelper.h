@@ -7,6 +7,13 @@
 #include "PusherComponentHelper.generated.h"
 
 
+/** A cached Blueprint result and the time it was cached */
+struct FPushPawnCachedResult
+{
+	bool bResult = false;
+	float Time = 0.f;
+};
+
 /**
  * Blueprint implementation to allow blueprint-only devs to use PushPawn
  * Create a blueprint class that inherits from this class and implement the functions
@@ -18,7 +25,51 @@ class PUSHPAWN_API UPusherComponentHelper final
 {
 	GENERATED_BODY()
 
+protected:
+	/**
+	 * If true, the result of Get Push Ability is cached and Blueprint is only called again when invalidated or when
+	 * PushAbilityRefreshInterval has passed
+	 * Every scan that touches this pusher otherwise calls into the Blueprint VM
+	 * @see InvalidatePushCache()
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Cache")
+	bool bCachePushAbility = false;
+
+	/**
+	 * How often to refresh the cached push ability
+	 * Set to 0 to only refresh when invalidated
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Cache", meta=(ClampMin="0", UIMin="0", Delta="0.1", ForceUnits="s", EditCondition="bCachePushAbility", EditConditionHides))
+	float PushAbilityRefreshInterval = 0.f;
+
+	/**
+	 * If true, the results of Is Push Capable and Can Push Pawn are cached for PushCapabilityCacheTTL
+	 * @see InvalidatePushCache()
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Cache")
+	bool bCachePushCapability = false;
+
+	/** How long the cached results of Is Push Capable and Can Push Pawn remain valid */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PushPawn|Cache", meta=(ClampMin="0", UIMin="0", Delta="0.05", ForceUnits="s", EditCondition="bCachePushCapability", EditConditionHides))
+	float PushCapabilityCacheTTL = 0.1f;
+
+private:
+	UPROPERTY(Transient, DuplicateTransient)
+	TSubclassOf<UGameplayAbility> CachedPushAbility;
+
+	float CachedPushAbilityTime = -1.f;
+
+	mutable TOptional<FPushPawnCachedResult> CachedPushCapable;
+
+	mutable TMap<TObjectKey<AActor>, FPushPawnCachedResult> CachedCanPushPawn;
+
+	float GetCacheTime() const;
+
 public:
+	/** Discard all cached Blueprint results, the next query will call Blueprint again */
+	UFUNCTION(BlueprintCallable, Category=PushPawn)
+	void InvalidatePushCache();
+
 	/** Get the ability that defines how we push another pawn */
 	UFUNCTION(BlueprintPure, BlueprintImplementableEvent, Category=PushPawn, meta=(DisplayName="Get Push Ability"))
 	TSubclassOf<UGameplayAbility> K2_GetPushAbility();
@@ -34,12 +85,12 @@ public:
 	 */
 	UFUNCTION(BlueprintPure, BlueprintImplementableEvent, Category=PushPawn, meta=(DisplayName="Is Push Capable"))
 	bool K2_IsPushCapable() const;
-	virtual bool IsPushCapable() const override { return K2_IsPushCapable(); }
+	virtual bool IsPushCapable() const override;
 
 	/** @return True if we can currently push the PusheeActor */
 	UFUNCTION(BlueprintPure, BlueprintImplementableEvent, Category=PushPawn, meta=(DisplayName="CanPushPawn"))
 	bool K2_CanPushPawn(const AActor* PusheeActor) const;
-	virtual bool CanPushPawn(const AActor* PusheeActor) const override { return K2_CanPushPawn(PusheeActor); }
+	virtual bool CanPushPawn(const AActor* PusheeActor) const override;
 
 	/** @return Optional runtime strength scaling to change how much the pusher pushes the pushee */
 	UFUNCTION(BlueprintPure, BlueprintNativeEvent, Category=PushPawn, meta=(DisplayName="Get Pusher Strength Scalar"))
@@ -8,6 +8,8 @@
 
 class IPusherTarget;
 struct FPushQuery;
+struct FPushPawnIgnoreList;
+struct FPusheeScanSnapshot;
 
 DECLARE_DELEGATE_OneParam(FOnPushPawnScanPaused, bool /* bIsPaused */);
 
@@ -62,6 +64,13 @@ public:
 	/** @return True if we can currently be pushed by the PusherActor */
 	virtual bool CanBePushedBy(const AActor* PusherActor) const = 0;
 
+	/**
+	 * Optionally, the push group (e.g. team or faction) we belong to, in the range [0, 32)
+	 * Checked against UPushPawnSubsystem's push group matrix in O(1) before CanBePushedBy()
+	 * @return INDEX_NONE to opt out of push groups
+	 */
+	virtual int32 GetPusheePushGroup() const { return INDEX_NONE; }
+
 	/** @return Optional runtime strength scaling to change how much the pushee is pushed */
 	virtual float GetPusheeStrengthScalar() const { return 1.f; }
 
@@ -89,6 +98,14 @@ public:
 	 */
 	virtual bool IsPusheeMovingOnGround() const = 0;
 
+	/**
+	 * Optionally, gather acceleration, velocity and IsMovingOnGround in a single call
+	 * The scan calls this once per scan instead of calling each getter individually, which is significantly cheaper
+	 * when the getters are implemented in Blueprint
+	 * @return False to fall back to GetPusheeAcceleration(), GetPusheeVelocity() and IsPusheeMovingOnGround()
+	 */
+	virtual bool GetPusheeScanSnapshot(FPusheeScanSnapshot& OutSnapshot) const { return false; }
+
 	/**
 	 * Get the collision shape of the pushee.
 	 * 
@@ -112,6 +129,13 @@ public:
 	 * @return Delegate for when the scan is paused or resumed
 	 */
 	virtual FOnPushPawnScanPaused* GetPushPawnScanPausedDelegate() { return nullptr; }
+
+	/**
+	 * Optionally, actors that our scan should never consider, e.g. mounted riders or carried NPCs
+	 * The scan caches its query params and only rebuilds them when the list's revision changes
+	 * @return The persistent ignore list, or nullptr if there is none
+	 */
+	virtual const FPushPawnIgnoreList* GetPushPawnIgnoreList() const { return nullptr; }
 };
 
 /** Interface for the target who does the pushing */
@@ -143,6 +167,13 @@ public:
 	/** @return True if we can currently push the PusheeActor */
 	virtual bool CanPushPawn(const AActor* PusheeActor) const = 0;
 
+	/**
+	 * Optionally, the push group (e.g. team or faction) we belong to, in the range [0, 32)
+	 * Checked against UPushPawnSubsystem's push group matrix in O(1) before CanPushPawn()
+	 * @return INDEX_NONE to opt out of push groups
+	 */
+	virtual int32 GetPusherPushGroup() const { return INDEX_NONE; }
+
 	/** @return Optional runtime strength scaling to change how much the pusher pushes the pushee */
 	virtual float GetPusherStrengthScalar() const { return 1.f; }
 
@@ -151,4 +182,87 @@ public:
 	 * @return True if Strength should override the applied strength
 	 */
 	virtual bool GetPusherStrengthOverride(float& Strength) const { return false; }
-};
\ No newline at end of file
+};
+
+/** Interface for movement components that can apply pushes directly, without root motion sources */
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UPushPawnMovementAccumulator : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Interface for movement components that can apply pushes directly, without root motion sources
+ * @see UPushPawnMovementComponent, EPushPawnForceBackend
+ */
+class IPushPawnMovementAccumulator
+{
+	GENERATED_BODY()
+
+public:
+	/** Accumulate a push velocity delta, to be applied during the next movement update */
+	virtual void AddPushVelocity(const FVector& DeltaVelocity) = 0;
+
+	/**
+	 * @return True if the predicting client sends its pushes with its moves
+	 * If so, the server doesn't apply pushes directly for remotely controlled pawns, or they would be applied twice
+	 */
+	virtual bool ReceivesPushesFromClientMoves() const { return true; }
+
+	/**
+	 * Server only, called instead of AddPushVelocity() for each validated push on a remotely controlled pawn
+	 * Push velocity received with the client's moves must be limited to what the server authorized this way,
+	 * otherwise the client has authority over its own push velocity
+	 */
+	virtual void AuthorizePushVelocity(const FVector& DeltaVelocity) {}
+
+	/**
+	 * @return The number of corrections the predicting client has received from the server that pushes may have
+	 * caused, e.g. that followed a move carrying a push, or INDEX_NONE if unknown
+	 * Used by adaptive net sync to measure if pushes are mispredicted, @see UPushPawn_Scan_Base::bAdaptiveNetSync
+	 */
+	virtual int32 GetNumClientCorrections() const { return INDEX_NONE; }
+};
+
+/** Interface for movement components that can send net syncs with the client's moves */
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UPushPawnSyncEpochProvider : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Interface for movement components that can send net syncs with the client's moves
+ * Each net sync on the predicting client advances an epoch that is sent with every move, the server's matching net
+ * sync completes once a move carrying that epoch arrives. Saves a reliable RPC for every net sync.
+ * @see UPushPawnMovementComponent, UAbilityTask_PushPawnSync
+ */
+class IPushPawnSyncEpochProvider
+{
+	GENERATED_BODY()
+
+public:
+	/** @return True if net syncs are currently sent with the client's moves, must be the same on server and client */
+	virtual bool IsPushSyncEpochEnabled() const = 0;
+
+	/** Predicting client only, advance the epoch sent with our moves */
+	virtual void AdvancePushSyncEpoch() = 0;
+
+	/** Server only, @return The epoch the next net sync waits for, and start waiting for it */
+	virtual uint8 AwaitNextPushSyncEpoch() = 0;
+
+	/** Server only, @return The epoch the most recent net sync waited for */
+	virtual uint8 GetAwaitedPushSyncEpoch() const = 0;
+
+	/** Server only, @return The latest epoch received with the client's moves */
+	virtual uint8 GetReceivedPushSyncEpoch() const = 0;
+
+	/** Server only, broadcast on the game thread after a move with a new epoch was received */
+	virtual FSimpleMulticastDelegate& OnPushSyncEpochReceived() = 0;
+
+	/** @return True if Received is Epoch or newer, epochs wrap around */
+	static bool HasReachedPushSyncEpoch(uint8 Received, uint8 Epoch)
+	{
+		return static_cast<int8>(Received - Epoch) >= 0;
+	}
+};
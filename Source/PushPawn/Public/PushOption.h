@@ -52,6 +52,20 @@ struct PUSHPAWN_API FPushOption
 	UPROPERTY(BlueprintReadOnly, Category=PushPawn)
 	FGameplayAbilitySpecHandle TargetPushAbilityHandle;
 
+	/** Pushers whose SortDistance differs by less than this, in cm, are ordered by PusherStableID instead */
+	static constexpr float SortDistanceTolerance = 10.f;
+
+	/**
+	 * Distance between the pushee and pusher, the primary sort key so the nearest pusher comes first
+	 * Compared with SortDistanceTolerance so that small differences between the client and server locations, e.g. from
+	 * interpolation or latency, don't change the order
+	 */
+	UPROPERTY(BlueprintReadOnly, Category=PushPawn, meta=(ForceUnits="cm"))
+	float SortDistance = 0.f;
+
+	/** The pusher's stable push ID, breaks SortDistance ties the same way on the client and server */
+	uint32 PusherStableID = 0;
+
 	FORCEINLINE bool operator==(const FPushOption& Other) const
 	{
 		return PusherTarget == Other.PusherTarget &&
@@ -67,8 +81,17 @@ struct PUSHPAWN_API FPushOption
 		return !operator==(Other);
 	}
 
+	/**
+	 * Network-consistent order, nearest pusher first and then by the pusher's stable ID
+	 * Pushers within SortDistanceTolerance of each other are ordered by ID alone, so there is no fixed bucket edge
+	 * that a small location difference can push one of them across
+	 */
 	FORCEINLINE bool operator<(const FPushOption& Other) const
 	{
-		return PusherTarget.GetInterface() < Other.PusherTarget.GetInterface();
+		if (FMath::Abs(SortDistance - Other.SortDistance) >= SortDistanceTolerance)
+		{
+			return SortDistance < Other.SortDistance;
+		}
+		return PusherStableID < Other.PusherStableID;
 	}
 };
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+class FPushPawnPhysicsForceBackend;
+
 class FPushPawnModule : public IModuleInterface
 {
 public:
@@ -12,4 +14,7 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	TUniquePtr<FPushPawnPhysicsForceBackend> PhysicsForceBackend;
 };
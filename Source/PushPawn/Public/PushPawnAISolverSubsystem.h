@@ -0,0 +1,57 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PushPawnAISolverSubsystem.generated.h"
+
+class APawn;
+class UPushPawn_Action_Base;
+
+/** A push between two AI pawns waiting to be solved */
+struct FPushPawnAISolverPush
+{
+	TWeakObjectPtr<const APawn> Pushee;
+	TWeakObjectPtr<const APawn> Pusher;
+
+	/** The pushee's push action, provides the push parameters */
+	TWeakObjectPtr<const UPushPawn_Action_Base> PushAction;
+
+	float StrengthScalar = 1.f;
+	bool bOverrideStrength = false;
+};
+
+/**
+ * Server-only solver for pushes where both the pushee and pusher are AI
+ *
+ * Nobody predicts AI on the server, so the push activation, target data, prediction keys and net syncs that
+ * UPushPawn_Scan_Base uses are pure overhead for them. Scans with bUseServerAISolver enabled queue their AI pushers
+ * here instead, and once per frame every queued push is recomputed from current positions, combined per pushee, and
+ * applied directly through the pushee's force backend.
+ *
+ * GAS activation is still used whenever either side is player controlled.
+ */
+UCLASS()
+class PUSHPAWN_API UPushPawnAISolverSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	TArray<FPushPawnAISolverPush> QueuedPushes;
+
+public:
+	static UPushPawnAISolverSubsystem* Get(const UWorld* World);
+
+	/** Queue a push between two AI pawns to be applied on the next tick */
+	static bool QueuePush(const UWorld* World, const FPushPawnAISolverPush& Push);
+
+	/** @return True if the pawn is AI and we are the server, which the solver can push without GAS */
+	static bool IsServerAIPawn(const APawn* Pawn);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+};
@@ -0,0 +1,44 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PushPawnCosmeticSubsystem.generated.h"
+
+class UPushPawnCosmeticComponent;
+
+/**
+ * Client-only cosmetic solver for simulated proxies, @see UPushPawnCosmeticComponent
+ *
+ * Each frame, registered pawns near the local viewpoint are hashed into a grid, and a budgeted number of simulated
+ * proxies compute a mesh offset away from the pawns they overlap. Every registered pawn is an obstacle, including the
+ * local player, but only simulated proxies are offset. Nothing is replicated and no RPCs are sent.
+ *
+ * Use p.PushPawn.Cosmetic.MaxPawnsPerFrame and p.PushPawn.Cosmetic.CullDistance to tune the cost
+ */
+UCLASS()
+class PUSHPAWN_API UPushPawnCosmeticSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UPushPawnCosmeticComponent>> Components;
+
+	/** Round robin cursor so every simulated proxy is eventually solved when over budget */
+	int32 SolveCursor = 0;
+
+public:
+	static UPushPawnCosmeticSubsystem* Get(const UWorld* World);
+
+	static void RegisterComponent(UPushPawnCosmeticComponent* Component);
+	static void UnregisterComponent(UPushPawnCosmeticComponent* Component);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+};
@@ -0,0 +1,34 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Features/IModularFeature.h"
+
+class APawn;
+struct FPushPawnActionParams;
+
+/**
+ * Applies push forces to pawns that don't use a UCharacterMovementComponent, e.g. a UMoverComponent
+ * Backends live in optional modules and register themselves as a modular feature under GetModularFeatureName()
+ *
+ * When FPushPawnActionParams::ForceBackend is Auto, the push action uses the first registered backend that can
+ * push the pawn if it has no UCharacterMovementComponent
+ * @see UPushStatics::FindPushForceBackend()
+ */
+class PUSHPAWN_API IPushPawnForceBackend : public IModularFeature
+{
+public:
+	static FName GetModularFeatureName()
+	{
+		static const FName FeatureName = TEXT("PushPawnForceBackend");
+		return FeatureName;
+	}
+
+	/** @return True if this backend can push the pawn, typically based on its movement component */
+	virtual bool CanApplyPushForce(const APawn* Pushee) const = 0;
+
+	/** Apply the push force (direction * strength) to the pawn for the given duration */
+	virtual void ApplyPushForce(const APawn* Pushee, const FVector& PushForce, float Duration,
+		const FPushPawnActionParams& Params) = 0;
+};
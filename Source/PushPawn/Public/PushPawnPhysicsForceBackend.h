@@ -0,0 +1,26 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PushPawnForceBackend.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Pushes pawns whose root component is a simulating primitive, e.g. vehicles and physics driven creatures
+ * Pushes are queued on UPushPawnPhysicsPushSubsystem and flushed as a single velocity change per body before each physics step,
+ * instead of calling into the physics scene for every push. Each push's velocity change is spread over its Duration
+ *
+ * Registered by the PushPawn module
+ */
+class PUSHPAWN_API FPushPawnPhysicsForceBackend : public IPushPawnForceBackend
+{
+public:
+	/** @return The pawn's root primitive if it is simulating physics */
+	static UPrimitiveComponent* GetSimulatingRootPrimitive(const APawn* Pawn);
+
+	virtual bool CanApplyPushForce(const APawn* Pushee) const override;
+	virtual void ApplyPushForce(const APawn* Pushee, const FVector& PushForce, float Duration,
+		const FPushPawnActionParams& Params) override;
+};
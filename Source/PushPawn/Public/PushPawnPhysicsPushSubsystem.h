@@ -0,0 +1,54 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PushPawnPhysicsPushSubsystem.generated.h"
+
+class UPrimitiveComponent;
+class FPhysScene_Chaos;
+
+/** A velocity change that is still being applied to a simulating body */
+struct FPushPawnPhysicsPush
+{
+	/** Velocity change that hasn't been applied yet */
+	FVector VelocityChange = FVector::ZeroVector;
+
+	/** The remaining velocity change is spread over this time */
+	float RemainingTime = 0.f;
+};
+
+/**
+ * Queue of pushes against simulating bodies, @see FPushPawnPhysicsForceBackend
+ *
+ * Each push's velocity change is spread over its duration, the same as a root motion source lasts for its duration.
+ * Pushes are merged per body, then flushed as a single velocity change per body right before each physics step.
+ */
+UCLASS()
+class PUSHPAWN_API UPushPawnPhysicsPushSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Pushes still being applied to each simulating body */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, TArray<FPushPawnPhysicsPush, TInlineAllocator<2>>> QueuedPhysicsPushes;
+
+	/** Bound to the physics scene pre-tick once a physics push is queued */
+	FDelegateHandle PhysScenePreTickHandle;
+
+public:
+	static UPushPawnPhysicsPushSubsystem* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Queue a velocity change for a simulating body, merged with any other pushes it receives on each physics step
+	 * @param Duration	The velocity change is spread evenly over this time, applied on the next step if zero
+	 */
+	static void QueuePhysicsPush(UPrimitiveComponent* Primitive, const FVector& VelocityChange, float Duration = 0.f);
+
+protected:
+	void FlushPhysicsPushes(FPhysScene_Chaos* PhysScene, float DeltaTime);
+	void UnbindPhysScenePreTick();
+};
@@ -0,0 +1,48 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PushPawnSpawnSeparationSubsystem.generated.h"
+
+class APawn;
+
+/**
+ * Separates pawns spawned on top of each other, server only
+ *
+ * Overlapping pawns are teleported apart by a one-shot position based solver before they start pushing, instead of
+ * resolving the overlap with a storm of push activations and net syncs.
+ */
+UCLASS()
+class PUSHPAWN_API UPushPawnSpawnSeparationSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Pawns spawned this frame, separated together on the next tick */
+	TArray<TWeakObjectPtr<APawn>> PendingSpawnSeparation;
+
+public:
+	static UPushPawnSpawnSeparationSubsystem* Get(const UWorld* World);
+
+	/**
+	 * Resolve overlaps between the pawns and teleport them apart, server only
+	 * Position based, the pawns' collision radii are iteratively separated in 2D using a grid, ignoring all other pawns
+	 * Call from spawners after spawning a wave of pawns
+	 * @param Pawns				The pawns to separate from each other
+	 * @param MaxIterations		More iterations resolve dense clusters more accurately
+	 * @return The number of pawns that were moved
+	 */
+	UFUNCTION(BlueprintCallable, Category=PushPawn)
+	int32 SeparatePawns(const TArray<APawn*>& Pawns, int32 MaxIterations = 4);
+
+	/**
+	 * Separate the pawn from every other pawn queued this frame, on the next tick, server only
+	 * @see UPushPawn_Scan_Base::bSeparateOnSpawn
+	 */
+	static void QueueSpawnSeparation(APawn* Pawn);
+
+protected:
+	void FlushSpawnSeparation();
+};
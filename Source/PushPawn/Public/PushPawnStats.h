@@ -0,0 +1,11 @@
+// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+/**
+ * Stat group used by the PushPawn plugin
+ * Use 'stat PushPawn' to view
+ */
+DECLARE_STATS_GROUP(TEXT("PushPawn"), STATGROUP_PushPawn, STATCAT_Advanced);
@@ -0,0 +1,78 @@
+// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PushPawnSubsystem.generated.h"
+
+/**
+ * Per-world push groups shared by all PushPawn pawns
+ *
+ * Pawns can optionally declare a push group (e.g. team or faction) via IPusheeInstigator::GetPusheePushGroup() and
+ * IPusherTarget::GetPusherPushGroup(). A bitmask matrix decides if one group can push another in O(1), which is
+ * checked before the CanBePushedBy() and CanPushPawn() interface calls, and before gathering push options.
+ * Pawns without a push group (INDEX_NONE) are never rejected by the matrix.
+ * The matrix is per world and is not replicated. It must be set identically on the server and every client, e.g.
+ * from BeginPlay of a class that exists everywhere such as the GameState, otherwise clients predict pushes the server
+ * won't perform (or miss pushes it does) and get corrected for it.
+ */
+UCLASS()
+class PUSHPAWN_API UPushPawnSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Push groups are in the range [0, MaxPushGroups) */
+	static constexpr int32 MaxPushGroups = 32;
+
+protected:
+	/** Bit N of entry M is set when push group M can push push group N */
+	uint32 PushGroupMatrix[MaxPushGroups];
+
+public:
+	UPushPawnSubsystem();
+
+	static UPushPawnSubsystem* Get(const UWorld* World);
+
+	//--------------------------------------------------------------
+	// PUSH GROUPS
+	//--------------------------------------------------------------
+
+	/**
+	 * Allow or prevent PusherGroup from pushing PusheeGroup
+	 * Not replicated, call this with the same arguments on the server and every client
+	 */
+	UFUNCTION(BlueprintCallable, Category=PushPawn)
+	void SetPushGroupCanPush(int32 PusherGroup, int32 PusheeGroup, bool bCanPush);
+
+	/**
+	 * Allow or prevent GroupA and GroupB from pushing each other
+	 * Not replicated, call this with the same arguments on the server and every client
+	 */
+	UFUNCTION(BlueprintCallable, Category=PushPawn)
+	void SetPushGroupsCanPushEachOther(int32 GroupA, int32 GroupB, bool bCanPush);
+
+	/** Allow every push group to push every other push group */
+	UFUNCTION(BlueprintCallable, Category=PushPawn)
+	void ResetPushGroups();
+
+	/** @return True if PusherGroup can push PusheeGroup, or if either has no push group */
+	UFUNCTION(BlueprintPure, Category=PushPawn)
+	bool CanPushGroupPush(int32 PusherGroup, int32 PusheeGroup) const
+	{
+		if (!IsValidPushGroup(PusherGroup) || !IsValidPushGroup(PusheeGroup))
+		{
+			return true;
+		}
+		return (PushGroupMatrix[PusherGroup] & (1u << PusheeGroup)) != 0;
+	}
+
+	/** @return True if the world's push group matrix allows PusherGroup to push PusheeGroup */
+	static bool IsPushAllowedByGroup(const UWorld* World, int32 PusherGroup, int32 PusheeGroup);
+
+	static bool IsValidPushGroup(int32 PushGroup)
+	{
+		return PushGroup >= 0 && PushGroup < MaxPushGroups;
+	}
+};
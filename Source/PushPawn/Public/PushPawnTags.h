@@ -10,4 +10,5 @@
 namespace FPushPawnTags
 {
  	PUSHPAWN_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(PushPawn_PushAbility_Activate);
+ 	PUSHPAWN_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(PushPawn_NetSync_Pending);
 };
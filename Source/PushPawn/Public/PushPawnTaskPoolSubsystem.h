@@ -0,0 +1,57 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PushPawnTaskPoolSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UAbilityTask;
+class UGameplayAbility;
+
+/**
+ * Finished ability tasks waiting to be re-used by an ability system component
+ */
+USTRUCT()
+struct PUSHPAWN_API FPushPawnTaskPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UAbilityTask>> FreeTasks;
+};
+
+/**
+ * Per ability system component pools of finished ability tasks, @see UAbilityTask_PushPawnPooled
+ *
+ * Pooled ability tasks are returned to their ability system component's pool when they end, and re-initialized for
+ * the next push instead of creating a new UObject for the GC to sweep.
+ */
+UCLASS()
+class PUSHPAWN_API UPushPawnTaskPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Finished ability tasks for each ability system component */
+	UPROPERTY(Transient)
+	TMap<TWeakObjectPtr<UAbilitySystemComponent>, FPushPawnTaskPool> TaskPools;
+
+public:
+	/** Don't keep more than this many free tasks for each ability system component, any excess is left to the GC */
+	static constexpr int32 MaxPooledTasksPerASC = 8;
+
+	static UPushPawnTaskPoolSubsystem* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * @return A free task of TaskClass owned by the ability's ability system component, or a new one if none are free
+	 * Returns null if the world has no subsystem
+	 */
+	static UAbilityTask* AcquirePooledTask(const UGameplayAbility* OwningAbility, const UClass* TaskClass);
+
+	/** Return a finished task to its ability system component's pool */
+	static void ReleasePooledTask(UAbilityTask* Task, UAbilitySystemComponent* ASC);
+};
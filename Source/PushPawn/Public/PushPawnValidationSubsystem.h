@@ -0,0 +1,58 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PushPawnValidationSubsystem.generated.h"
+
+class APlayerController;
+struct FPushPawnValidationParams;
+
+/**
+ * How much the server trusts the pushes predicted by a single client
+ */
+struct FPushPawnClientValidation
+{
+	/** Accumulates FullValidationFraction for every push, a push is fully validated each time this reaches 1 */
+	float FullValidationAccumulator = 0.f;
+
+	/** Invalid pushes, leaking away over the error window */
+	float ErrorScore = 0.f;
+
+	double LastErrorTime = 0.0;
+
+	/** Every push is fully validated until this time */
+	double EscalatedUntil = -1.0;
+};
+
+/**
+ * Server validation state for clients that predict pushes, @see FPushPawnValidationParams
+ *
+ * Tracks how often the server fully validates each client's predicted pushes, and escalates clients that send
+ * invalid pushes to full validation.
+ */
+UCLASS()
+class PUSHPAWN_API UPushPawnValidationSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Validation state for each client that predicts pushes */
+	TMap<TWeakObjectPtr<const APlayerController>, FPushPawnClientValidation> ClientValidation;
+
+public:
+	static UPushPawnValidationSubsystem* Get(const UWorld* World);
+
+	/**
+	 * @return True if the client's push should be fully validated, server only
+	 * Either a FullValidationFraction sample, or every push while the client is escalated
+	 */
+	static bool ShouldFullyValidatePush(const APlayerController* Client, const FPushPawnValidationParams& Params);
+
+	/** Record an invalid push from the client, escalating it to full validation if it keeps happening */
+	static void ReportInvalidPush(const APlayerController* Client, const FPushPawnValidationParams& Params);
+
+protected:
+	FPushPawnClientValidation* FindOrAddClientValidation(const APlayerController* Client);
+};
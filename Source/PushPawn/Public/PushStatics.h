@@ -18,6 +18,8 @@ class UGameplayAbility;
 class FPushOptionBuilder;
 class IPusheeInstigator;
 class IPusherTarget;
+class IPushPawnMovementAccumulator;
+class IPushPawnForceBackend;
 
 /**
  * Static helper functions for PushPawn
@@ -64,6 +66,64 @@ public:
 	static void GetPushDataFromEventData(const FGameplayEventData& EventData, bool bForce2D, FVector& PushDirection,
 		float& DistanceBetween, float& StrengthScalar, bool& bOverrideStrength);
 
+	/**
+	 * @return The number of pushes contained in the event data, greater than 1 when the scan batches pushes
+	 * @see UPushPawn_Scan_Base::bBatchPushes
+	 */
+	UFUNCTION(BlueprintPure, Category=PushPawn)
+	static int32 GetNumPushesInEventData(const FGameplayEventData& EventData);
+
+	/**
+	 * Extracts a batched push from the event data
+	 * Batched pushes carry the normalized distance because only the first pusher is available from the event data
+	 * @param EventData		The event data to extract the push from
+	 * @param PushIndex		The push to extract, in the range [0, GetNumPushesInEventData())
+	 * @param bForce2D		Whether to force the direction to be 2D
+	 * @param PushDirection The normalized push direction from the event data
+	 * @param NormalizedDistance The distance between pusher & pushee at the time of the event, normalized by their combined radius
+	 * @param StrengthScalar The scalar to apply to the push strength.
+	 * @param bOverrideStrength If true, the strength scalar should override the strength calculation
+	 * @return True if the push at PushIndex was found
+	 */
+	UFUNCTION(BlueprintCallable, Category=PushPawn)
+	static bool GetBatchedPushDataFromEventData(const FGameplayEventData& EventData, int32 PushIndex, bool bForce2D,
+		FVector& PushDirection, float& NormalizedDistance, float& StrengthScalar, bool& bOverrideStrength);
+
+	/**
+	 * Sum the force (direction * strength) of each batched push in the event data, starting from FirstPushIndex
+	 * The sum starts from InitialForce and is clamped to Params.MaxBatchedForceScalar times the strongest push
+	 * @see GetBatchedPushDataFromEventData()
+	 */
+	static FVector AccumulateBatchedPushForce(const APawn* Pushee, const FGameplayEventData& EventData,
+		int32 FirstPushIndex, const FPushPawnActionParams& Params, const FVector& InitialForce = FVector::ZeroVector);
+
+	/**
+	 * @return The pawn's movement component push accumulator if the force backend allows using it
+	 * Null if the backend is RootMotionSource or the movement component doesn't implement IPushPawnMovementAccumulator
+	 */
+	static IPushPawnMovementAccumulator* GetPushMovementAccumulator(const APawn* Pawn, EPushPawnForceBackend Backend);
+
+	/**
+	 * Accumulate the push on the pawn's movement component if the force backend allows using it
+	 * Remotely controlled pawns only authorize the push, it is received with the client's moves
+	 * @return False if the pawn has no usable movement accumulator
+	 */
+	static bool AccumulatePushForce(const APawn* Pushee, const FVector& PushForce, EPushPawnForceBackend Backend);
+
+	/**
+	 * @return The first registered force backend that can push the pawn if the backend selection is Auto
+	 * @see IPushPawnForceBackend
+	 */
+	static IPushPawnForceBackend* FindPushForceBackend(const APawn* Pawn, EPushPawnForceBackend Backend);
+
+	/**
+	 * Apply a push force (direction * strength) to the pawn without an ability task, using the force backend
+	 * selected by Params. Root motion sources end themselves after Params.Duration
+	 * Root motion sources are always merged into an active PushPawnForce source, regardless of Params.bMergePushForces
+	 * @return False if the pawn has no movement component or force backend that can be pushed
+	 */
+	static bool ApplyPushForceDirect(const APawn* Pushee, const FVector& PushForce, const FPushPawnActionParams& Params);
+
 public:
 	//--------------------------------------------------------------
 	// ABILITY HELPER METHODS
@@ -90,6 +150,13 @@ public:
 	static float GetPawnGroundSpeed(const APawn* Pawn);
 	
 	static float GetPusheeGroundSpeed(const IPusheeInstigator* Pushee);
+	static float GetPusheeGroundSpeed(const FPusheeScanSnapshot& Snapshot);
+
+	/**
+	 * Gather the pushee's scan state once, using IPusheeInstigator::GetPusheeScanSnapshot() if implemented
+	 * The returned acceleration is normalized
+	 */
+	static FPusheeScanSnapshot GetPusheeScanSnapshot(const IPusheeInstigator* Pushee);
 
 public:
 	UFUNCTION(BlueprintPure, Category=PushPawn)
@@ -105,6 +172,17 @@ public:
 	UFUNCTION(BlueprintPure, Category=PushPawn)
 	static float GetPushStrength(const APawn* Pushee, float Distance, const FPushPawnActionParams& Params);
 
+	/**
+	 * Returns the push strength based on the push parameters, for pushees that aren't pawns (e.g. Mass entities)
+	 * Evaluates the same curves as GetPushStrength() so that pawns and entities feel the same
+	 * Thread-safe, does not touch any UObject other than the read-only curves
+	 * @param PusheeSpeed	The ground speed of the pushee
+	 * @param Distance		The normalized distance between the pushee and pusher
+	 * @param Params		The push parameters
+	 * @return The push strength
+	 */
+	static float GetPushStrengthForSpeed(float PusheeSpeed, float Distance, const FPushPawnActionParams& Params);
+
 	/** 
 	 * Returns the push strength based on the push parameters
 	 * @param Pushee				The pawn being pushed
@@ -141,6 +219,21 @@ public:
 	 */
 	static float CalculatePushDirection(const FVector& Direction, const FRotator& BaseRotation);
 
+	/**
+	 * @return An ID for the actor that is the same on the server and every client, its net GUID if it has one
+	 * Falls back to a hash of the actor's name, which matches for actors loaded with the level but not for actors that
+	 * were spawned without replicating, those can be ordered or tie-broken differently on each side
+	 */
+	static uint32 GetStablePushID(const AActor* Actor);
+
+	/**
+	 * Direction to push pawns that overlap almost exactly, when no direction can be derived from their locations
+	 * Derived from a hash of both pawns' stable IDs so the predicting client and the server agree, and the two pawns
+	 * are always pushed in opposite directions
+	 * @return A normalized 2D direction
+	 */
+	static FVector GetTieBreakPushDirection(const AActor* Pushee, const AActor* Pusher);
+
 	UFUNCTION(BlueprintCallable, Category=PushPawn, meta=(ExpandEnumAsExecs="ValidPushDirection", DisplayName="Get Push Direction 4-Way"))
 	static EPushCardinal_4Way GetPushDirection_4Way(const AActor* FromActor, const AActor* ToActor, EValidPushDirection& ValidPushDirection);
 	
@@ -60,6 +60,29 @@ enum class EPushPawnPauseType : uint8
 	ActivationFailed,
 };
 
+UENUM(BlueprintType)
+enum class EPushPawnScanQueryType : uint8
+{
+	Channel			UMETA(ToolTip="Sweep against TraceChannel, this returns anything that responds to the channel including static geometry"),
+	ObjectType		UMETA(ToolTip="Sweep against ObjectTypes only (e.g. Pawn or a custom PushPawn object type), unrelated geometry is rejected during broadphase"),
+};
+
+UENUM(BlueprintType)
+enum class EPushPawnNetSyncScanMode : uint8
+{
+	Pause			UMETA(ToolTip="Scanning stops until the net sync completes, the pawn has no soft collision for up to a round trip"),
+	Continue		UMETA(ToolTip="Scanning and pushing continue during the net sync, pushes are tagged PushPawn.NetSync.Pending and the server always fully validates them if it validates client pushes"),
+	Buffer			UMETA(ToolTip="Scanning continues during the net sync, a single push is held and triggered as soon as the net sync completes. The latest push wins, it uses the push options from the most recent scan and any earlier pushes during the net sync are dropped"),
+};
+
+UENUM(BlueprintType)
+enum class EPushPawnForceBackend : uint8
+{
+	Auto					UMETA(ToolTip="Use the movement component's push accumulator if it has one, otherwise use a root motion source. Pawns without a UCharacterMovementComponent use a registered IPushPawnForceBackend, e.g. PushPawnMover"),
+	RootMotionSource		UMETA(ToolTip="Apply the push as a root motion source via UAbilityTask_PushPawnForce"),
+	MovementAccumulator		UMETA(ToolTip="Accumulate the push directly on the movement component, e.g. UPushPawnMovementComponent, falls back to a root motion source if unavailable"),
+};
+
 UENUM(BlueprintType)
 enum class EPushPawnOverrideHandling : uint8
 {
@@ -82,6 +105,9 @@ struct PUSHPAWN_API FPushPawnActionParams
 		, Duration(0.1f)
 		, StrengthScalar(1.f)
 		, bDistanceCheck2D(true)
+		, bMergePushForces(false)
+		, ForceBackend(EPushPawnForceBackend::Auto)
+		, MaxBatchedForceScalar(2.f)
 	{}
 
 	/** Scale the push strength by the pushee's own velocity */
@@ -92,7 +118,10 @@ struct PUSHPAWN_API FPushPawnActionParams
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
 	TObjectPtr<UCurveFloat> DistanceToStrengthCurve;
 
-	/** How long the push force lasts for */
+	/**
+	 * How long the push force lasts for
+	 * Physics pushes spread their velocity change over this time, the movement accumulator applies it at once
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", Delta="0.1", ForceUnits="s"))
 	float Duration;
 
@@ -103,6 +132,93 @@ struct PUSHPAWN_API FPushPawnActionParams
 	/** If true, the distance check will be handled in 2D space */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
 	bool bDistanceCheck2D;
+
+	/**
+	 * If true, a push applied while another push force is active is folded into the existing root motion source
+	 * Keeps root motion work and correction payload size constant under repeated pushes instead of stacking sources
+	 * Pushes applied without a task, e.g. by UPushPawn_Action_NonInstanced, are always merged
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
+	bool bMergePushForces;
+
+	/**
+	 * How the push force is applied to the pushee's movement
+	 * Root motion sources are serialized into saved moves and replayed during corrections, a movement accumulator
+	 * sends a single compressed push velocity with the client's moves instead
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
+	EPushPawnForceBackend ForceBackend;
+
+	/**
+	 * The combined force of a batch of pushes is limited to this multiple of the strongest push in the batch
+	 * Stops a batch from summing into an arbitrarily large push
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="1", UIMin="1", Delta="0.1", ForceUnits="x"))
+	float MaxBatchedForceScalar;
+};
+
+/**
+ * Server validation of pushes predicted by clients
+ * Cheap bounds checks run on every push, while only a fraction of pushes are fully validated against the server's own
+ * state. Clients that keep sending invalid pushes are fully validated for a while.
+ */
+USTRUCT(BlueprintType)
+struct PUSHPAWN_API FPushPawnValidationParams
+{
+	GENERATED_BODY()
+
+	FPushPawnValidationParams()
+		: bValidateClientPushes(false)
+		, FullValidationFraction(0.1f)
+		, MaxBatchedPushes(8)
+		, MaxStrengthScalar(4.f)
+		, MaxNormalizedDistance(2.f)
+		, MaxDirectionError(60.f)
+		, MaxNormalizedDistanceError(1.f)
+		, ErrorsToEscalate(3)
+		, ErrorWindow(10.f)
+		, EscalationDuration(30.f)
+	{}
+
+	/** If true, the server validates pushes predicted by clients and rejects invalid pushes */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
+	bool bValidateClientPushes;
+
+	/** Fraction of each client's pushes that are fully validated, the remainder only have their bounds checked */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", ClampMax="1", UIMax="1", Delta="0.05", EditCondition="bValidateClientPushes", EditConditionHides))
+	float FullValidationFraction;
+
+	/** Bounds check, events batching more pushes than this are rejected */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="1", UIMin="1", EditCondition="bValidateClientPushes", EditConditionHides))
+	int32 MaxBatchedPushes;
+
+	/** Bounds check, pushes with a larger strength scalar are rejected */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", Delta="0.1", ForceUnits="x", EditCondition="bValidateClientPushes", EditConditionHides))
+	float MaxStrengthScalar;
+
+	/** Bounds check, pushes from further away than this fraction of the pushee and pusher's combined radius are rejected */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", Delta="0.1", ForceUnits="x", EditCondition="bValidateClientPushes", EditConditionHides))
+	float MaxNormalizedDistance;
+
+	/** Full validation, the push direction can't differ from the server's by more than this */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", ClampMax="180", UIMax="180", ForceUnits="deg", EditCondition="bValidateClientPushes", EditConditionHides))
+	float MaxDirectionError;
+
+	/** Full validation, the push distance can't differ from the server's by more than this fraction of the combined radius */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", Delta="0.1", ForceUnits="x", EditCondition="bValidateClientPushes", EditConditionHides))
+	float MaxNormalizedDistanceError;
+
+	/** This many invalid pushes within ErrorWindow escalate the client to full validation */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="1", UIMin="1", EditCondition="bValidateClientPushes", EditConditionHides))
+	int32 ErrorsToEscalate;
+
+	/** Invalid pushes older than this no longer count towards escalation */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0.1", UIMin="0.1", Delta="1", ForceUnits="s", EditCondition="bValidateClientPushes", EditConditionHides))
+	float ErrorWindow;
+
+	/** How long an escalated client has every push fully validated */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", Delta="1", ForceUnits="s", EditCondition="bValidateClientPushes", EditConditionHides))
+	float EscalationDuration;
 };
 
 /**
@@ -119,10 +235,25 @@ struct PUSHPAWN_API FPushPawnScanParams
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
 	bool bDirectionIs2D;
 
-	/** Channel to use when tracing for Pawns that can push us back */
+	/** Whether to sweep against TraceChannel or ObjectTypes */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
+	EPushPawnScanQueryType QueryType;
+
+	/** Channel to use when tracing for Pawns that can push us back */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(EditCondition="QueryType == EPushPawnScanQueryType::Channel", EditConditionHides))
 	TEnumAsByte<ECollisionChannel> TraceChannel;
 
+	/**
+	 * Object types to sweep for Pawns that can push us back, e.g. Pawn or a custom PushPawn object type
+	 * Walls, floors and props are rejected during broadphase instead of being processed as potential pushers
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(EditCondition="QueryType == EPushPawnScanQueryType::ObjectType", EditConditionHides))
+	TArray<TEnumAsByte<ECollisionChannel>> ObjectTypes;
+
+	/** If true, only movable objects are queried, static geometry is rejected during broadphase */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn)
+	bool bDynamicObjectsOnly;
+
 	/** Modifies scan range */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=PushPawn, meta=(ClampMin="0", UIMin="0", Delta="0.1", ForceUnits="x"))
 	float ScanRangeScalar;
@@ -156,6 +287,71 @@ struct PUSHPAWN_API FPushPawnScanParams
 	EPushPawnOverrideHandling StrengthOverrideHandling;
 };
 
+/**
+ * The pushee's movement state, gathered once per scan and shared by the scan and scan rate
+ * @see IPusheeInstigator::GetPusheeScanSnapshot()
+ */
+USTRUCT(BlueprintType)
+struct PUSHPAWN_API FPusheeScanSnapshot
+{
+	GENERATED_BODY()
+
+	FPusheeScanSnapshot()
+		: Acceleration(FVector::ZeroVector)
+		, Velocity(FVector::ZeroVector)
+		, bIsMovingOnGround(true)
+	{}
+
+	/**
+	 * Acceleration of the Pushee, will be normalized post-retrieval
+	 * UCharacterMovementComponent::GetCurrentAcceleration()
+	 */
+	UPROPERTY(BlueprintReadWrite, Category=PushPawn)
+	FVector Acceleration;
+
+	/**
+	 * Velocity of the Pushee
+	 * AActor::GetVelocity()
+	 */
+	UPROPERTY(BlueprintReadWrite, Category=PushPawn)
+	FVector Velocity;
+
+	/**
+	 * Whether the pushee is moving on the ground (not in the air)
+	 * UPawnMovementComponent::IsMovingOnGround()
+	 */
+	UPROPERTY(BlueprintReadWrite, Category=PushPawn)
+	bool bIsMovingOnGround;
+};
+
+/**
+ * Actors that a pushee's scan should never consider, e.g. mounted riders or carried NPCs
+ * The revision changes whenever the list is modified, allowing scans to rebuild their cached query params
+ */
+USTRUCT(BlueprintType)
+struct PUSHPAWN_API FPushPawnIgnoreList
+{
+	GENERATED_BODY()
+
+	/** Add an actor to ignore, returns true if the list changed */
+	bool Add(AActor* Actor);
+
+	/** Stop ignoring an actor, returns true if the list changed */
+	bool Remove(const AActor* Actor);
+
+	/** Stop ignoring all actors */
+	void Reset();
+
+	const TArray<TWeakObjectPtr<AActor>>& GetActors() const { return Actors; }
+	uint32 GetRevision() const { return Revision; }
+
+private:
+	UPROPERTY(Transient)
+	TArray<TWeakObjectPtr<AActor>> Actors;
+
+	uint32 Revision = 0;
+};
+
 /**
  * Blueprint cannot use FCollisionShape, so we need to create a helper struct
  */
@@ -3,10 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Abilities/Tasks/AbilityTask.h"
+#include "AbilityTask_PushPawnPooled.h"
 #include "AbilityTask_PushPawnForce.generated.h"
 
 class UCharacterMovementComponent;
+struct FRootMotionSource_ConstantForce;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FApplyPushPawnForceDelegate);
 
 /**
@@ -17,7 +18,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FApplyPushPawnForceDelegate);
  *	Because it is local predicted and originates from CMC, it is not necessary to replicate
  */
 UCLASS()
-class PUSHPAWN_API UAbilityTask_PushPawnForce : public UAbilityTask
+class PUSHPAWN_API UAbilityTask_PushPawnForce : public UAbilityTask_PushPawnPooled
 {
 	GENERATED_BODY()
 
@@ -33,7 +34,8 @@ public:
 		float Duration,
 		bool bIsAdditive = true,
 		bool bEnableGravity = true,
-		UCurveFloat* StrengthOverTime = nullptr
+		UCurveFloat* StrengthOverTime = nullptr,
+		bool bMergeWithExisting = false
 	);
 
 	/** Apply force to character's movement */
@@ -46,18 +48,55 @@ public:
 		float Duration,
 		bool bIsAdditive = true,
 		bool bEnableGravity = true,
-		UCurveFloat* StrengthOverTime = nullptr
+		UCurveFloat* StrengthOverTime = nullptr,
+		bool bMergeWithExisting = false
 	);
 
+	/**
+	 * Apply a PushPawnForce root motion source directly, without a task
+	 * Used by non-instanced actions that can't own a task, the source ends itself after Duration
+	 * @return The ID of the applied root motion source
+	 */
+	static uint16 ApplyPushForce(UCharacterMovementComponent* InMovementComponent, const FVector& Force, float InDuration,
+		bool bInIsAdditive = true, bool bInEnableGravity = true, UCurveFloat* InStrengthOverTime = nullptr);
+
+	/**
+	 * Fold Force into an active PushPawnForce root motion source, if there is a compatible one
+	 * The existing source is replaced by a new one applying the merged force, it is never edited in place
+	 * @param OutRemainingTime How long the merged source will last from now
+	 * @return The ID of the merged source, or ERootMotionSourceID::Invalid if there was nothing to merge into
+	 */
+	static uint16 MergePushForce(UCharacterMovementComponent* InMovementComponent, const FVector& Force,
+		float InDuration, bool bInIsAdditive, bool bInEnableGravity, UCurveFloat* InStrengthOverTime,
+		float& OutRemainingTime);
+
 	virtual void InitSimulatedTask(UGameplayTasksComponent& InGameplayTasksComponent) override;
 	
 	virtual void SharedInitAndApply();
+
+	/**
+	 * Replace the active root motion source with a new one applying the new force for InDuration from now
+	 * Used by continuous push actions to avoid a new task for every push
+	 * @return True if the root motion source was replaced
+	 */
+	virtual bool UpdatePushForce(const FVector& InWorldDirection, float InStrength, float InDuration);
 	
 protected:
 	bool HasTimedOut() const;
 
+	/** Fold our force into an active PushPawnForce root motion source, if there is one */
+	bool MergeWithExistingForce();
+
+	/**
+	 * @return True if our root motion source is still active and therefore ours to remove
+	 * Merging replaces the source, so once another push merges into it our ID no longer exists
+	 */
+	bool OwnsRootMotionSource() const;
+
 	virtual void OnDestroy(bool bInOwnerFinished) override;
 
+	virtual void ResetPooledTask() override;
+
 public:
 	UPROPERTY(BlueprintAssignable)
 	FApplyPushPawnForceDelegate OnFinish;
@@ -86,7 +125,12 @@ protected:
 
 	UPROPERTY()
 	bool bEnableGravity;
+
+	/** If true, fold into an active PushPawnForce root motion source instead of adding another */
+	UPROPERTY()
+	bool bMergeWithExisting;
 	
+	/** The LocalID of the root motion source we last wrote, identifies ownership when merging */
 	uint16 RootMotionSourceID;
 
 public:
@@ -0,0 +1,75 @@
+// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/Tasks/AbilityTask.h"
+#include "Abilities/PushPawn_Ability.h"
+#include "PushPawnTaskPoolSubsystem.h"
+#include "AbilityTask_PushPawnPooled.generated.h"
+
+class UAbilityTask_PushPawnPooled;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPushPawnPooledTaskReleased, UAbilityTask_PushPawnPooled* /* Task */);
+
+/**
+ * Base for PushPawn ability tasks that can be re-used from a per ability system component pool
+ *
+ * When the owning ability opts in via UPushPawn_Ability::bPoolAbilityTasks, NewPooledAbilityTask() re-initializes a
+ * finished task instead of creating a new UObject, and OnDestroy() ends the task without marking it as garbage and
+ * returns it to the pool. Simulated tasks replicate to simulated proxies by object, which a re-used task would break,
+ * so tasks whose class sets bSimulatedTask are never pooled, nor are replicated copies (InitSimulatedTask).
+ *
+ * Anything holding onto a pooled task outside of the owning ability must let go when OnReleasedToPool() broadcasts,
+ * the same task will be handed out again by the next NewPooledAbilityTask() call.
+ */
+UCLASS(Abstract)
+class PUSHPAWN_API UAbilityTask_PushPawnPooled : public UAbilityTask
+{
+	GENERATED_BODY()
+
+public:
+	/** Same as NewAbilityTask, except it will come from the pool if the owning ability opts in */
+	template <class T>
+	static T* NewPooledAbilityTask(UGameplayAbility* ThisAbility, FName InstanceName = FName())
+	{
+		check(ThisAbility);
+
+		const UPushPawn_Ability* PushAbility = Cast<UPushPawn_Ability>(ThisAbility);
+		if (!PushAbility || !PushAbility->ShouldPoolAbilityTasks() || GetDefault<T>()->IsSimulatedTask())
+		{
+			return NewAbilityTask<T>(ThisAbility, InstanceName);
+		}
+
+		T* MyObj = Cast<T>(UPushPawnTaskPoolSubsystem::AcquirePooledTask(ThisAbility, T::StaticClass()));
+		if (!MyObj)
+		{
+			return NewAbilityTask<T>(ThisAbility, InstanceName);
+		}
+
+		static_cast<UAbilityTask_PushPawnPooled*>(MyObj)->InitPooledTask(*ThisAbility, InstanceName);
+		return MyObj;
+	}
+
+	bool IsPooled() const { return bPooled; }
+
+	/** Broadcast once, just before the task is returned to the pool */
+	FOnPushPawnPooledTaskReleased& OnReleasedToPool() { return ReleasedToPoolDelegate; }
+
+protected:
+	/** Reset any state set by a previous use, called before returning to the pool */
+	virtual void ResetPooledTask();
+
+	virtual void OnDestroy(bool bInOwnerFinished) override;
+
+private:
+	void InitPooledTask(UGameplayAbility& ThisAbility, FName InInstanceName);
+
+	/** True while this task is in use and should be returned to the pool when it ends */
+	bool bPooled = false;
+
+	/** True from when the task is returned to the pool until it is re-used, it must not be destroyed again */
+	bool bReleasedToPool = false;
+
+	FOnPushPawnPooledTaskReleased ReleasedToPoolDelegate;
+};
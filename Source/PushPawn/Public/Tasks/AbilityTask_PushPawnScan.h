@@ -5,9 +5,11 @@
 #include "CoreMinimal.h"
 #include "AbilityTask_PushPawnScan_Base.h"
 #include "PushTypes.h"
+#include "CollisionQueryParams.h"
 #include "AbilityTask_PushPawnScan.generated.h"
 
 class UAbilityTask_PushPawnSync;
+class UAbilityTask_PushPawnPooled;
 
 /**
  * Implemented by the PushPawn Scan ability.
@@ -26,6 +28,9 @@ class PUSHPAWN_API UAbilityTask_PushPawnScan : public UAbilityTask_PushPawnScan_
 public:
 	UFUNCTION()
 	void OnNetSync(UAbilityTask_PushPawnSync* SyncPoint);
+
+	/** A pooled net sync is about to be re-used, stop tracking it */
+	void OnNetSyncReleased(UAbilityTask_PushPawnPooled* SyncPoint);
 	
 	void ActivateTimer(EPushPawnPauseType PauseType = EPushPawnPauseType::NotPaused);
 
@@ -51,6 +56,9 @@ private:
 	void PerformTrace();
 
 	void OnScanPaused(bool bIsPaused);
+
+	/** Rebuild the cached query params if the avatar or the pushee's ignore list changed */
+	void UpdateQueryParams(const AActor* AvatarActor, const IPusheeInstigator* Pushee);
 	
 	UPROPERTY(Transient, DuplicateTransient)
 	FPushPawnScanParams ScanParams;
@@ -67,13 +75,35 @@ private:
 	/** Tracked to prevent premature GC and allow ending during OnDestroy */
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UAbilityTask_PushPawnSync>> SyncPoints;
+
+	/** When the current net sync started, to measure how long the scan was paused */
+	float NetSyncStartTime = 0.f;
 	
 private:
 	UPROPERTY(Transient, DuplicateTransient)
 	float CurrentScanRate;
 
+	/** The pushee's state gathered by the most recent scan, consumed by ActivateTimer() */
+	UPROPERTY(Transient, DuplicateTransient)
+	FPusheeScanSnapshot ScanSnapshot;
+
+	/** True if ScanSnapshot was gathered by the scan that is about to re-arm the timer */
+	bool bHasScanSnapshot = false;
+
 	FTimerHandle TimerHandle;
 
+	/** Built once and reused by every scan, rebuilt only when the avatar or the pushee's ignore list changes */
+	FCollisionQueryParams QueryParams;
+
+	/** Built alongside QueryParams when using EPushPawnScanQueryType::ObjectType */
+	FCollisionObjectQueryParams ObjectQueryParams;
+
+	/** The avatar QueryParams were built for */
+	TWeakObjectPtr<const AActor> QueryParamsAvatar;
+
+	/** The ignore list revision QueryParams were built for */
+	uint32 QueryParamsIgnoreRevision = 0;
+
 	FConsoleVariableDelegate OnDisabledDelegate;
 	
 	FOnPushPawnScanPaused* OnPushPawnScanPauseStateChangedDelegate = nullptr;
@@ -13,6 +13,7 @@ class UPushPawn_Scan_Base;
 class UGameplayAbility;
 class UPrimitiveComponent;
 class AActor;
+struct FCollisionObjectQueryParams;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPushObjectsChangedEvent, const TArray<FPushOption>&, PushOptions);
 
@@ -43,9 +44,21 @@ protected:
 protected:
 	UAbilityTask_PushPawnScan_Base(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 	
+	/** Sweep the shape in place, every hit is returned so that all nearby pushers can be considered */
+	static void ShapeTrace(TArray<FHitResult>& OutHitResults, const UWorld* World, const FVector& Center, const FQuat& Rotation,
+		const ECollisionChannel ChannelName, const FCollisionQueryParams& Params, const FCollisionShape& Shape);
+
+	static void ShapeTraceByObjectType(TArray<FHitResult>& OutHitResults, const UWorld* World, const FVector& Center, const FQuat& Rotation,
+		const FCollisionObjectQueryParams& ObjectParams, const FCollisionQueryParams& Params, const FCollisionShape& Shape);
+
+	UE_DEPRECATED(5.5, "Use the ShapeTrace overload that returns every hit instead")
 	static void ShapeTrace(FHitResult& OutHitResult, const UWorld* World, const FVector& Center, const FQuat& Rotation,
 		const ECollisionChannel ChannelName, const FCollisionQueryParams& Params, const FCollisionShape& Shape);
 
+	UE_DEPRECATED(5.5, "Use the ShapeTraceByObjectType overload that returns every hit instead")
+	static void ShapeTraceByObjectType(FHitResult& OutHitResult, const UWorld* World, const FVector& Center, const FQuat& Rotation,
+		const FCollisionObjectQueryParams& ObjectParams, const FCollisionQueryParams& Params, const FCollisionShape& Shape);
+
 	void UpdatePushOptions(const FPushQuery& PushQuery, const TArray<TScriptInterface<IPusherTarget>>& PushTargets);
 
 	virtual void OnDestroy(bool bInOwnerFinished) override;
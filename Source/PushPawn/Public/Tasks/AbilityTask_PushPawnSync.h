@@ -3,19 +3,23 @@
 
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
-#include "Abilities/Tasks/AbilityTask.h"
+#include "AbilityTask_PushPawnPooled.h"
 #include "AbilityTask_PushPawnSync.generated.h"
 
 class UAbilityTask_PushPawnSync;
+class IPushPawnSyncEpochProvider;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPushPawnNetworkSyncDelegate, UAbilityTask_PushPawnSync*, SyncPoint);
 
 /**
  * Task for providing a generic sync point for client server (one can wait for a signal from the other)
  * Identical to UAbilityTask_SyncPushPawn, except the delegate provides the node that broadcasted so it can be removed from a TArray
  * Only performs OnlyServerWait
+ *
+ * If the avatar's movement component implements IPushPawnSyncEpochProvider and has it enabled, the client's signal is
+ * sent with its moves as an epoch instead of a reliable generic replicated event
  */
 UCLASS()
-class PUSHPAWN_API UAbilityTask_PushPawnSync : public UAbilityTask
+class PUSHPAWN_API UAbilityTask_PushPawnSync : public UAbilityTask_PushPawnPooled
 {
 	GENERATED_BODY()
 
@@ -28,6 +32,8 @@ public:
 	UFUNCTION()
 	void OnSignalCallback();
 
+	void OnPushSyncEpochReceived();
+
 	virtual void Activate() override;
 
 	/**
@@ -50,6 +56,18 @@ protected:
 
 	void SyncFinished();
 
+	virtual void OnDestroy(bool bInOwnerFinished) override;
+
+	virtual void ResetPooledTask() override;
+
+	/** @return The avatar's movement component if it sends net syncs with its moves */
+	IPushPawnSyncEpochProvider* GetPushSyncEpochProvider() const;
+
 	/** The event we replicate */
 	EAbilityGenericReplicatedEvent::Type ReplicatedEventToListenFor;
+
+	/** The epoch we're waiting for the client's moves to reach */
+	uint8 AwaitedPushSyncEpoch = 0;
+
+	FDelegateHandle PushSyncEpochHandle;
 };